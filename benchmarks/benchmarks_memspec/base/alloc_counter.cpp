@@ -0,0 +1,46 @@
+#include "alloc_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace alloc_counter
+{
+
+std::atomic<std::size_t> allocations{0};
+std::atomic<std::size_t> bytes{0};
+
+} // namespace alloc_counter
+
+void* operator new(std::size_t size)
+{
+    alloc_counter::allocations.fetch_add(1, std::memory_order_relaxed);
+    alloc_counter::bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
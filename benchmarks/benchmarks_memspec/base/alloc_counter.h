@@ -0,0 +1,50 @@
+#ifndef BENCHMARKS_MEMSPEC_ALLOC_COUNTER_H
+#define BENCHMARKS_MEMSPEC_ALLOC_COUNTER_H
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace alloc_counter
+{
+
+// Counted by the replaced global operator new in alloc_counter.cpp
+extern std::atomic<std::size_t> allocations;
+extern std::atomic<std::size_t> bytes;
+
+// Snapshot of the counters at construction, reported per iteration on destruction
+class Scope
+{
+public:
+    explicit Scope(benchmark::State& state) :
+        state(state),
+        startAllocations(allocations.load(std::memory_order_relaxed)),
+        startBytes(bytes.load(std::memory_order_relaxed))
+    {
+    }
+
+    ~Scope()
+    {
+        const auto iterations = static_cast<double>(state.iterations());
+        if (iterations == 0)
+            return;
+        state.counters["allocs/op"] =
+            static_cast<double>(allocations.load(std::memory_order_relaxed) - startAllocations) /
+            iterations;
+        state.counters["bytes/op"] =
+            static_cast<double>(bytes.load(std::memory_order_relaxed) - startBytes) / iterations;
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    benchmark::State& state;
+    std::size_t startAllocations;
+    std::size_t startBytes;
+};
+
+} // namespace alloc_counter
+
+#endif /* BENCHMARKS_MEMSPEC_ALLOC_COUNTER_H */
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+
+#include "DRAMUtils/memspec/ActivateWindow.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+constexpr std::uint64_t window = 32;
+constexpr std::uint64_t rrd = 8;
+
+} // namespace
+
+// Activates issued as early as possible
+static void BM_ActivateWindow(benchmark::State& state)
+{
+    MemSpec::ActivateWindow<> activates(window);
+    std::uint64_t time = 0;
+    for (auto _ : state)
+    {
+        time = std::max(time + rrd, activates.earliestNextAct());
+        activates.activate(time);
+    }
+    benchmark::DoNotOptimize(time);
+}
+BENCHMARK(BM_ActivateWindow);
+
+// Baseline, the std::deque used by controllers
+static void BM_ActivateDeque(benchmark::State& state)
+{
+    std::deque<std::uint64_t> activates;
+    std::uint64_t time = 0;
+    for (auto _ : state)
+    {
+        std::uint64_t earliest = 0;
+        if (activates.size() == 4)
+            earliest = activates.front() + window;
+        time = std::max(time + rrd, earliest);
+        if (activates.size() == 4)
+            activates.pop_front();
+        activates.push_back(time);
+    }
+    benchmark::DoNotOptimize(time);
+}
+BENCHMARK(BM_ActivateDeque);
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "alloc_counter.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+MemSpec::MemSpecVariant createDDR5()
+{
+    MemSpec::MemSpecDDR5 memspec{};
+    memspec.memoryId = "Bench_DDR5";
+    memspec.memarchitecturespec.nbrOfRows = 65536;
+    memspec.memtimingspec.tCK = 0.625;
+    MemSpec::MemSpecVariant variant;
+    variant.setVariant(memspec);
+    return variant;
+}
+
+} // namespace
+
+static void BM_ParseBinary(benchmark::State& state, BinaryFormat format)
+{
+    const std::vector<std::uint8_t> buffer = write_memspec_to_binary(createDDR5(), format);
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        MemSpec::MemSpecVariant memspec;
+        benchmark::DoNotOptimize(parse_memspec_from_binary(buffer, memspec, format));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK_CAPTURE(BM_ParseBinary, CBOR, BinaryFormat::CBOR);
+BENCHMARK_CAPTURE(BM_ParseBinary, MessagePack, BinaryFormat::MessagePack);
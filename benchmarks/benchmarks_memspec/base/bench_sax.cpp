@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "alloc_counter.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+std::string createDDR5Buffer()
+{
+    MemSpec::MemSpecDDR5 memspec{};
+    memspec.memoryId = "Bench_DDR5";
+    memspec.memarchitecturespec.nbrOfRows = 65536;
+    memspec.memtimingspec.tCK = 0.625;
+    MemSpec::MemSpecVariant variant;
+    variant.setVariant(memspec);
+
+    json_t j;
+    j["memspec"] = variant;
+    return j.dump(4);
+}
+
+const std::string& ddr5Buffer()
+{
+    static const std::string buffer = createDDR5Buffer();
+    return buffer;
+}
+
+} // namespace
+
+static void BM_ParseBuffer_Dom(benchmark::State& state)
+{
+    const std::string& buffer = ddr5Buffer();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_Memspec_from_buffer(buffer);
+        benchmark::DoNotOptimize(memspec);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK(BM_ParseBuffer_Dom);
+
+static void BM_ParseBuffer_Sax(benchmark::State& state)
+{
+    const std::string& buffer = ddr5Buffer();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_memspec_from_buffer_sax(buffer);
+        benchmark::DoNotOptimize(memspec);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+BENCHMARK(BM_ParseBuffer_Sax);
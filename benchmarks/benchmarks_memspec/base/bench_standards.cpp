@@ -0,0 +1,258 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "DRAMUtils/util/hash.h"
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/memspec/MemSpecSnapshot.h"
+
+#include "alloc_counter.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+// Value initialized MemSpec of the standard T, every field of the standard is serialized
+template <typename T>
+MemSpec::MemSpecVariant createMemSpec()
+{
+    T memspec{};
+    memspec.memoryId = "Bench_" + std::string(T::id);
+    MemSpec::MemSpecVariant variant;
+    variant.setVariant(memspec);
+    return variant;
+}
+
+template <typename T>
+const json_t& memSpecJson()
+{
+    static const json_t json = [] {
+        json_t j;
+        j["memspec"] = createMemSpec<T>();
+        return j;
+    }();
+    return json;
+}
+
+template <typename T>
+const std::string& memSpecBuffer()
+{
+    static const std::string buffer = memSpecJson<T>().dump(4);
+    return buffer;
+}
+
+template <typename T>
+const std::filesystem::path& memSpecFile()
+{
+    static const std::filesystem::path path = [] {
+        auto path = std::filesystem::temp_directory_path() /
+                    ("dramutils_bench_" + std::string(T::id) + ".json");
+        std::ofstream(path) << memSpecBuffer<T>();
+        return path;
+    }();
+    return path;
+}
+
+template <typename T>
+const std::filesystem::path& memSpecSnapshotFile()
+{
+    static const std::filesystem::path path = [] {
+        auto path = std::filesystem::temp_directory_path() /
+                    ("dramutils_bench_" + std::string(T::id) + ".snapshot");
+        MemSpec::write_memspec_snapshot(path, createMemSpec<T>());
+        return path;
+    }();
+    return path;
+}
+
+template <typename T>
+void BM_ParseJson(benchmark::State& state)
+{
+    const json_t& json = memSpecJson<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_memspec_from_json(json);
+        benchmark::DoNotOptimize(memspec);
+    }
+}
+
+template <typename T>
+void BM_ParseBuffer(benchmark::State& state)
+{
+    const std::string& buffer = memSpecBuffer<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_Memspec_from_buffer(buffer);
+        benchmark::DoNotOptimize(memspec);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+
+template <typename T>
+void BM_ParseBufferSax(benchmark::State& state)
+{
+    const std::string& buffer = memSpecBuffer<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_memspec_from_buffer_sax(buffer);
+        benchmark::DoNotOptimize(memspec);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+
+// Happy path of the error reporting parser, compare with BM_ParseBufferSax
+template <typename T>
+void BM_ParseBufferChecked(benchmark::State& state)
+{
+    const std::string& buffer = memSpecBuffer<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_memspec_from_buffer_checked(buffer);
+        benchmark::DoNotOptimize(memspec);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+
+template <typename T>
+void BM_ParseFile(benchmark::State& state)
+{
+    const std::filesystem::path& path = memSpecFile<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto memspec = parse_memspec_from_file(path);
+        benchmark::DoNotOptimize(memspec);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * memSpecBuffer<T>().size()));
+}
+
+// Zero copy load, compare with BM_ParseFile
+template <typename T>
+void BM_OpenSnapshot(benchmark::State& state)
+{
+    const std::filesystem::path& path = memSpecSnapshotFile<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        auto snapshot = MemSpec::MemSpecSnapshot::open(path);
+        benchmark::DoNotOptimize(snapshot->template get<T>());
+    }
+}
+
+template <typename T>
+void BM_ToJson(benchmark::State& state)
+{
+    const MemSpec::MemSpecVariant memspec = createMemSpec<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        json_t json;
+        memspec.to_json(json);
+        benchmark::DoNotOptimize(json);
+    }
+}
+
+// DOM based serialization to text, compare with BM_WriteJson
+template <typename T>
+void BM_DumpJson(benchmark::State& state)
+{
+    const MemSpec::MemSpecVariant memspec = createMemSpec<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        json_t json;
+        memspec.to_json(json["memspec"]);
+        std::string text = json.dump();
+        benchmark::DoNotOptimize(text);
+    }
+}
+
+template <typename T>
+void BM_WriteJson(benchmark::State& state)
+{
+    const MemSpec::MemSpecVariant memspec = createMemSpec<T>();
+    std::string text;
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        text.clear();
+        write_memspec_to_json(text, memspec);
+        benchmark::DoNotOptimize(text);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+
+// Previous way of keying MemSpecs, compare with BM_ContentHash
+template <typename T>
+void BM_DumpHash(benchmark::State& state)
+{
+    const MemSpec::MemSpecVariant memspec = createMemSpec<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        json_t json;
+        memspec.to_json(json);
+        benchmark::DoNotOptimize(util::fnv1a(json.dump()));
+    }
+}
+
+template <typename T>
+void BM_ContentHash(benchmark::State& state)
+{
+    const MemSpec::MemSpecVariant memspec = createMemSpec<T>();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(util::content_hash(memspec));
+}
+
+template <typename T>
+void BM_Equal(benchmark::State& state)
+{
+    const MemSpec::MemSpecVariant memspec = createMemSpec<T>();
+    const MemSpec::MemSpecVariant copy = memspec;
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(&memspec);
+        benchmark::DoNotOptimize(memspec == copy);
+    }
+}
+
+template <typename T>
+void registerStandard()
+{
+    const std::string id(T::id);
+    benchmark::RegisterBenchmark(("BM_ParseJson/" + id).c_str(), BM_ParseJson<T>);
+    benchmark::RegisterBenchmark(("BM_ParseBuffer/" + id).c_str(), BM_ParseBuffer<T>);
+    benchmark::RegisterBenchmark(("BM_ParseBufferSax/" + id).c_str(), BM_ParseBufferSax<T>);
+    benchmark::RegisterBenchmark(("BM_ParseBufferChecked/" + id).c_str(), BM_ParseBufferChecked<T>);
+    benchmark::RegisterBenchmark(("BM_ParseFile/" + id).c_str(), BM_ParseFile<T>);
+    benchmark::RegisterBenchmark(("BM_OpenSnapshot/" + id).c_str(), BM_OpenSnapshot<T>);
+    benchmark::RegisterBenchmark(("BM_ToJson/" + id).c_str(), BM_ToJson<T>);
+    benchmark::RegisterBenchmark(("BM_DumpJson/" + id).c_str(), BM_DumpJson<T>);
+    benchmark::RegisterBenchmark(("BM_WriteJson/" + id).c_str(), BM_WriteJson<T>);
+    benchmark::RegisterBenchmark(("BM_DumpHash/" + id).c_str(), BM_DumpHash<T>);
+    benchmark::RegisterBenchmark(("BM_ContentHash/" + id).c_str(), BM_ContentHash<T>);
+    benchmark::RegisterBenchmark(("BM_Equal/" + id).c_str(), BM_Equal<T>);
+}
+
+// Registers the benchmarks for every entry of MemSpec::VariantTypes
+template <typename... Ts>
+bool registerStandards(util::type_sequence<Ts...>)
+{
+    (registerStandard<Ts>(), ...);
+    return true;
+}
+
+const bool registered = registerStandards(MemSpec::VariantTypes{});
+
+} // namespace
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/memspec/MemSpecSweep.h"
+
+#include "alloc_counter.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+MemSpec::MemSpecSweep createSweep()
+{
+    MemSpec::MemSpecDDR5 memspec{};
+    memspec.memoryId = "Bench_Sweep";
+    MemSpec::MemSpecVariant base;
+    base.setVariant(memspec);
+    return MemSpec::MemSpecSweep(base, {
+        MemSpec::MemSpecSweep::Range::linear("memtimingspec.RCD", 30, 49, 1),
+        MemSpec::MemSpecSweep::Range::linear("memtimingspec.RP", 30, 49, 1),
+        MemSpec::MemSpecSweep::Range::linear("mempowerspec.idd4r", 0.1, 1.0, 0.1),
+    });
+}
+
+} // namespace
+
+// One point of the cartesian product per iteration
+static void BM_SweepIterate(benchmark::State& state)
+{
+    const MemSpec::MemSpecSweep sweep = createSweep();
+    auto it = sweep.begin();
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        if (++it == sweep.end())
+            it = sweep.begin();
+        benchmark::DoNotOptimize(&*it);
+    }
+}
+BENCHMARK(BM_SweepIterate);
+
+// Baseline, every point is written as json and parsed back
+static void BM_SweepWriteParse(benchmark::State& state)
+{
+    const MemSpec::MemSpecSweep sweep = createSweep();
+    std::size_t index = 0;
+    std::string text;
+    alloc_counter::Scope scope(state);
+    for (auto _ : state)
+    {
+        index = (index + 1) % sweep.size();
+        text.clear();
+        write_memspec_to_json(text, sweep.at(index));
+        auto memspec = parse_memspec_from_buffer_sax(text);
+        benchmark::DoNotOptimize(memspec);
+    }
+}
+BENCHMARK(BM_SweepWriteParse);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+MemSpec::MemSpecDDR5 createDDR5()
+{
+    MemSpec::MemSpecDDR5 memspec{};
+    auto& arch = memspec.memarchitecturespec;
+    arch.nbrOfRanks = 2;
+    arch.nbrOfBankGroups = 8;
+    arch.nbrOfBanks = 32;
+    arch.burstLength = 16;
+    arch.dataRate = 2;
+    auto& t = memspec.memtimingspec;
+    t.RCD = 39;
+    t.RP = 39;
+    t.RAS = 77;
+    t.RL = 40;
+    t.WL = 38;
+    t.RTP = 18;
+    t.WR = 72;
+    t.CCD_L_slr = 12;
+    t.CCD_S_slr = 8;
+    t.CCD_L_WR_slr = 48;
+    t.RRD_L_slr = 12;
+    t.RRD_S_slr = 8;
+    t.FAW_slr = 32;
+    t.WTR_L = 24;
+    t.WTR_S = 6;
+    t.RTRS = 2;
+    t.RFC1_slr = 472;
+    return memspec;
+}
+
+struct Request
+{
+    MemSpec::TimingCommand command;
+    MemSpec::BankAddress address;
+};
+
+std::vector<Request> createRequests(std::size_t count)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> rank(0, 1), group(0, 7), bank(0, 3), command(0, 4);
+    std::vector<Request> requests(count);
+    for (auto& request : requests)
+        request = {static_cast<MemSpec::TimingCommand>(command(rng)), {rank(rng), group(rng), bank(rng)}};
+    return requests;
+}
+
+} // namespace
+
+// Earliest issue time and issue of a random command stream, timing only
+static void BM_TimingCheckerIssue(benchmark::State& state)
+{
+    auto checker = MemSpec::make_timing_checker(createDDR5());
+    const std::vector<Request> requests = createRequests(4096);
+    std::uint64_t time = 0;
+    for (auto _ : state)
+    {
+        for (const auto& request : requests)
+        {
+            time = std::max(time, checker.earliest(request.command, request.address));
+            checker.issue(request.command, request.address, time);
+        }
+        benchmark::DoNotOptimize(time);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * requests.size()));
+}
+BENCHMARK(BM_TimingCheckerIssue);
@@ -0,0 +1,38 @@
+###############################################
+###     dramutils_generate_memspec_header   ###
+###############################################
+###
+### Generates a header holding a constexpr
+### MemSpec from a memspec json file with the
+### dramutils_memspec_codegen tool
+###
+### dramutils_generate_memspec_header(
+###     INPUT <memspec.json>
+###     OUTPUT <header.h>
+###     NAME <struct name>
+###     [NAMESPACE <namespace>]
+###     [KEY <memspec key>])
+###
+### The OUTPUT has to be added to the sources
+### of a target to trigger the generation.
+###
+
+function( dramutils_generate_memspec_header )
+    cmake_parse_arguments(ARG "" "INPUT;OUTPUT;NAME;NAMESPACE;KEY" "" ${ARGN})
+
+    set(CODEGEN_ARGS ${ARG_INPUT} ${ARG_OUTPUT} --name ${ARG_NAME})
+    if(ARG_NAMESPACE)
+        list(APPEND CODEGEN_ARGS --namespace ${ARG_NAMESPACE})
+    endif()
+    if(ARG_KEY)
+        list(APPEND CODEGEN_ARGS --key ${ARG_KEY})
+    endif()
+
+    add_custom_command(
+        OUTPUT ${ARG_OUTPUT}
+        COMMAND dramutils_memspec_codegen ${CODEGEN_ARGS}
+        DEPENDS dramutils_memspec_codegen ${ARG_INPUT}
+        COMMENT "Generating MemSpec header ${ARG_OUTPUT}"
+        VERBATIM
+    )
+endfunction()
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_CONFIG_ADDRESS_DECODER_H
+#define DRAMUTILS_CONFIG_ADDRESS_DECODER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "DRAMUtils/config/address_mapping.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DRAMUTILS_HAS_PEXT 1
+#include <immintrin.h>
+#else
+#define DRAMUTILS_HAS_PEXT 0
+#endif
+
+namespace DRAMUtils::Config {
+
+enum class AddressField : std::size_t
+{
+    Channel,
+    Rank,
+    BankGroup,
+    Bank,
+    Row,
+    Column,
+    Byte,
+    Count
+};
+
+struct DecodedAddress
+{
+    std::uint64_t channel = 0;
+    std::uint64_t rank = 0;
+    std::uint64_t bankGroup = 0;
+    std::uint64_t bank = 0; // Bank within the bank group
+    std::uint64_t row = 0;
+    std::uint64_t column = 0;
+    std::uint64_t byte = 0;
+};
+
+// Number of elements of every address field
+struct AddressGeometry
+{
+    std::uint64_t channels = 1;
+    std::uint64_t ranks = 1;
+    std::uint64_t bankGroups = 1;
+    std::uint64_t banksPerGroup = 1;
+    std::uint64_t rows = 1;
+    std::uint64_t columns = 1;
+};
+
+namespace detail {
+
+template <typename T, typename = void>
+struct has_bank_groups : std::false_type {};
+template <typename T>
+struct has_bank_groups<T, std::void_t<decltype(T::nbrOfBankGroups)>> : std::true_type {};
+
+} // namespace detail
+
+// Geometry of a MemArchitectureSpecType, nbrOfBanks is the number of banks of all bank groups
+template <typename MemArchitectureSpec>
+AddressGeometry make_address_geometry(const MemArchitectureSpec& spec) noexcept
+{
+    AddressGeometry geometry;
+    geometry.channels = spec.nbrOfChannels;
+    geometry.ranks = spec.nbrOfRanks;
+    geometry.banksPerGroup = spec.nbrOfBanks;
+    if constexpr (detail::has_bank_groups<MemArchitectureSpec>::value)
+    {
+        if (spec.nbrOfBankGroups > 1)
+        {
+            geometry.bankGroups = spec.nbrOfBankGroups;
+            geometry.banksPerGroup = spec.nbrOfBanks / spec.nbrOfBankGroups;
+        }
+    }
+    geometry.rows = spec.nbrOfRows;
+    geometry.columns = spec.nbrOfColumns;
+    return geometry;
+}
+
+/**
+ * @brief Decodes physical addresses into channel, rank, bank group, bank, row, column and byte
+ *        according to an AddressMapping.
+ *        If the CPU supports BMI2 and the bits of every field are listed in ascending order,
+ *        every field is extracted with a single PEXT instruction. Otherwise the fields are
+ *        assembled from a precomputed table of contiguous bit runs (mask and shift).
+ */
+class AddressDecoder
+{
+public:
+    static constexpr std::size_t fields = static_cast<std::size_t>(AddressField::Count);
+
+    /**
+     * @brief Throws std::invalid_argument if a bit is used twice or is out of range, or if the
+     *        number of bits of a field does not match the power of two element count of the
+     *        geometry. The byte bits are not checked against the geometry.
+     */
+    AddressDecoder(const AddressMapping& mapping, const AddressGeometry& geometry)
+    {
+        const std::array<const std::optional<std::vector<unsigned>>*, fields> bits{
+            &mapping.CHANNEL_BIT, &mapping.RANK_BIT, &mapping.BANKGROUP_BIT, &mapping.BANK_BIT,
+            &mapping.ROW_BIT, &mapping.COLUMN_BIT, &mapping.BYTE_BIT};
+        const std::array<std::uint64_t, fields - 1> counts{
+            geometry.channels, geometry.ranks, geometry.bankGroups, geometry.banksPerGroup,
+            geometry.rows, geometry.columns};
+        static constexpr std::array<const char*, fields> names{
+            "CHANNEL_BIT", "RANK_BIT", "BANKGROUP_BIT", "BANK_BIT", "ROW_BIT", "COLUMN_BIT", "BYTE_BIT"};
+
+        std::uint64_t used = 0;
+        bool ascending = true;
+        for (std::size_t field = 0; field < fields; ++field)
+        {
+            static const std::vector<unsigned> none;
+            const auto& fieldBits = bits[field]->has_value() ? **bits[field] : none;
+
+            if (field < counts.size() && counts[field] != (std::uint64_t{1} << fieldBits.size()))
+                throw std::invalid_argument(std::string("AddressDecoder: ") + names[field] +
+                                            " does not match the number of elements " + std::to_string(counts[field]));
+
+            for (std::size_t i = 0; i < fieldBits.size(); ++i)
+            {
+                const unsigned bit = fieldBits[i];
+                if (bit >= 64 || (used >> bit) & 1)
+                    throw std::invalid_argument(std::string("AddressDecoder: invalid or duplicate bit ") +
+                                                std::to_string(bit) + " in " + names[field]);
+                used |= std::uint64_t{1} << bit;
+                masks_[field] |= std::uint64_t{1} << bit;
+                ascending = ascending && (i == 0 || fieldBits[i - 1] < bit);
+
+                // Extend the run if source and destination bits are both consecutive
+                if (i > 0 && fieldBits[i - 1] + 1 == bit && !runs_.empty())
+                    runs_.back().mask = (runs_.back().mask << 1) | 1;
+                else
+                    runs_.push_back(Run{static_cast<std::uint8_t>(field), static_cast<std::uint8_t>(bit),
+                                        static_cast<std::uint8_t>(i), 1});
+            }
+        }
+        pext_ = ascending && cpuHasBmi2();
+    }
+
+    template <typename MemArchitectureSpec>
+    AddressDecoder(const AddressMapping& mapping, const MemArchitectureSpec& spec) :
+        AddressDecoder(mapping, make_address_geometry(spec))
+    {}
+
+    DecodedAddress decode(std::uint64_t address) const noexcept
+    {
+        DecodedAddress decoded;
+        decode(&address, &decoded, 1);
+        return decoded;
+    }
+
+    // Decodes count addresses into out
+    void decode(const std::uint64_t* addresses, DecodedAddress* out, std::size_t count) const noexcept
+    {
+#if DRAMUTILS_HAS_PEXT
+        if (pext_)
+        {
+            decodePext(addresses, out, count);
+            return;
+        }
+#endif
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::array<std::uint64_t, fields> values{};
+            for (const Run& run : runs_)
+                values[run.field] |= ((addresses[i] >> run.source) & run.mask) << run.dest;
+            out[i] = toDecoded(values);
+        }
+    }
+
+    // Mask of the address bits of a field
+    std::uint64_t mask(AddressField field) const noexcept { return masks_[static_cast<std::size_t>(field)]; }
+
+    // True if the PEXT kernel is used
+    bool usesPext() const noexcept { return pext_; }
+
+private:
+    // ((address >> source) & mask) << dest is added to field
+    struct Run
+    {
+        std::uint8_t field;
+        std::uint8_t source;
+        std::uint8_t dest;
+        std::uint64_t mask;
+    };
+
+    static DecodedAddress toDecoded(const std::array<std::uint64_t, fields>& values) noexcept
+    {
+        return DecodedAddress{values[0], values[1], values[2], values[3], values[4], values[5], values[6]};
+    }
+
+    static bool cpuHasBmi2() noexcept
+    {
+#if DRAMUTILS_HAS_PEXT
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("bmi2");
+#else
+        return false;
+#endif
+    }
+
+#if DRAMUTILS_HAS_PEXT
+    __attribute__((target("bmi2")))
+    void decodePext(const std::uint64_t* addresses, DecodedAddress* out, std::size_t count) const noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::array<std::uint64_t, fields> values;
+            for (std::size_t field = 0; field < fields; ++field)
+                values[field] = _pext_u64(addresses[i], masks_[field]);
+            out[i] = toDecoded(values);
+        }
+    }
+#endif
+
+    std::array<std::uint64_t, fields> masks_{};
+    std::vector<Run> runs_;
+    bool pext_ = false;
+};
+
+} // namespace DRAMUtils::Config
+
+#endif /* DRAMUTILS_CONFIG_ADDRESS_DECODER_H */
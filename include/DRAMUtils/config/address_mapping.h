@@ -0,0 +1,26 @@
+#ifndef DRAMUTILS_CONFIG_ADDRESS_MAPPING_H
+#define DRAMUTILS_CONFIG_ADDRESS_MAPPING_H
+
+#include <optional>
+#include <vector>
+
+#include <DRAMUtils/util/json_utils.h>
+
+namespace DRAMUtils::Config {
+
+// Physical address bits of every field, the first entry is the least significant bit of the field
+struct AddressMapping
+{
+    std::optional<std::vector<unsigned>> BYTE_BIT;
+    std::optional<std::vector<unsigned>> COLUMN_BIT;
+    std::optional<std::vector<unsigned>> ROW_BIT;
+    std::optional<std::vector<unsigned>> BANK_BIT;
+    std::optional<std::vector<unsigned>> BANKGROUP_BIT;
+    std::optional<std::vector<unsigned>> RANK_BIT;
+    std::optional<std::vector<unsigned>> CHANNEL_BIT;
+};
+NLOHMANN_JSONIFY_ALL_THINGS(AddressMapping, BYTE_BIT, COLUMN_BIT, ROW_BIT, BANK_BIT, BANKGROUP_BIT, RANK_BIT, CHANNEL_BIT)
+
+} // namespace DRAMUtils::Config
+
+#endif /* DRAMUTILS_CONFIG_ADDRESS_MAPPING_H */
@@ -12,11 +12,11 @@ enum class TogglingRateIdlePattern
     Z = 2,
     Invalid = -1
 };
-NLOHMANN_JSON_SERIALIZE_ENUM(TogglingRateIdlePattern,
-                             {{TogglingRateIdlePattern::Invalid, nullptr},
-                              {TogglingRateIdlePattern::L, "L"},
-                              {TogglingRateIdlePattern::H, "H"},
-                              {TogglingRateIdlePattern::Z, "Z"}})
+DRAMUTILS_JSON_SERIALIZE_ENUM(TogglingRateIdlePattern,
+                              {{TogglingRateIdlePattern::Invalid, nullptr},
+                               {TogglingRateIdlePattern::L, "L"},
+                               {TogglingRateIdlePattern::H, "H"},
+                               {TogglingRateIdlePattern::Z, "Z"}})
 
 struct ToggleRateDefinition
 {
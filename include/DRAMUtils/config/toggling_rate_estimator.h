@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_CONFIG_TOGGLING_RATE_ESTIMATOR_H
+#define DRAMUTILS_CONFIG_TOGGLING_RATE_ESTIMATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "DRAMUtils/config/toggling_rate.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DRAMUTILS_HAS_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define DRAMUTILS_HAS_X86_SIMD 0
+#endif
+
+namespace DRAMUtils::Config {
+
+namespace detail {
+
+inline std::uint64_t popcount64(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::uint64_t>(__builtin_popcountll(value));
+#else
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (value * 0x0101010101010101ull) >> 56;
+#endif
+}
+
+inline std::uint64_t load64(const std::uint8_t* data) noexcept
+{
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+// Number of set bits in a[i] ^ b[i], or in a[i] if b is nullptr
+inline std::uint64_t popcount_xor_scalar(const std::uint8_t* a, const std::uint8_t* b, std::size_t size) noexcept
+{
+    std::uint64_t count = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        count += popcount64(b ? load64(a + i) ^ load64(b + i) : load64(a + i));
+    for (; i < size; ++i)
+        count += popcount64(b ? a[i] ^ b[i] : a[i]);
+    return count;
+}
+
+#if DRAMUTILS_HAS_X86_SIMD
+
+// Nibble lookup popcount, see Mula et al., "Faster Population Counts Using AVX2 Instructions"
+__attribute__((target("avx2")))
+inline std::uint64_t popcount_xor_avx2(const std::uint8_t* a, const std::uint8_t* b, std::size_t size) noexcept
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+    __m256i total = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if (b)
+            v = _mm256_xor_si256(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        const __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low_mask));
+        const __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+        // Horizontal byte sums into the four 64 bit lanes
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+
+    alignas(32) std::uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + popcount_xor_scalar(a + i, b ? b + i : nullptr, size - i);
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vpopcntdq")))
+inline std::uint64_t popcount_xor_avx512(const std::uint8_t* a, const std::uint8_t* b, std::size_t size) noexcept
+{
+    __m512i total = _mm512_setzero_si512();
+
+    std::size_t i = 0;
+    for (; i + 64 <= size; i += 64)
+    {
+        __m512i v = _mm512_loadu_si512(a + i);
+        if (b)
+            v = _mm512_xor_si512(v, _mm512_loadu_si512(b + i));
+        total = _mm512_add_epi64(total, _mm512_popcnt_epi64(v));
+    }
+    alignas(64) std::uint64_t lanes[8];
+    _mm512_store_si512(lanes, total);
+    std::uint64_t count = 0;
+    for (const std::uint64_t lane : lanes)
+        count += lane;
+    return count + popcount_xor_scalar(a + i, b ? b + i : nullptr, size - i);
+}
+
+#endif /* DRAMUTILS_HAS_X86_SIMD */
+
+using popcount_xor_fn = std::uint64_t (*)(const std::uint8_t*, const std::uint8_t*, std::size_t) noexcept;
+
+// Widest kernel supported by the executing CPU, selected once
+inline popcount_xor_fn select_popcount_xor() noexcept
+{
+#if DRAMUTILS_HAS_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vpopcntdq") && __builtin_cpu_supports("avx512bw"))
+        return popcount_xor_avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return popcount_xor_avx2;
+#endif
+    return popcount_xor_scalar;
+}
+
+inline std::uint64_t popcount_xor(const std::uint8_t* a, const std::uint8_t* b, std::size_t size) noexcept
+{
+    static const popcount_xor_fn kernel = select_popcount_xor();
+    return kernel(a, b, size);
+}
+
+} // namespace detail
+
+/**
+ * @brief Estimates the toggling rates and duty cycles of the data bus from raw burst data.
+ *        A burst consists of burstLength beats of width bits, stored consecutively with
+ *        width / 8 bytes per beat. Bit i of a beat is the value of data line i.
+ *        The toggling rate is the fraction of toggling lines between consecutive beats of a
+ *        burst, the duty cycle the fraction of ones in all beats.
+ *        The counts are computed with AVX-512 or AVX2 XOR+popcount kernels if the CPU supports
+ *        them and with a scalar kernel otherwise.
+ */
+class ToggleRateEstimator
+{
+public:
+    // Throws std::invalid_argument if width is no multiple of 8 or burstLength is 0
+    ToggleRateEstimator(std::uint64_t width, std::uint64_t burstLength) :
+        beatBytes_(width / 8),
+        burstBytes_(width / 8 * burstLength),
+        burstLength_(burstLength)
+    {
+        if (width == 0 || width % 8 != 0 || burstLength == 0)
+            throw std::invalid_argument("ToggleRateEstimator: width must be a multiple of 8 and burstLength must not be 0");
+    }
+
+    // Width and burstLength of the memarchitecturespec of a MemSpec
+    template <typename MemArchitectureSpec>
+    explicit ToggleRateEstimator(const MemArchitectureSpec& spec) :
+        ToggleRateEstimator(spec.width, spec.burstLength)
+    {}
+
+    // Adds whole bursts of read data, throws std::invalid_argument if size is no multiple of the burst size
+    void addRead(const std::uint8_t* data, std::size_t size) { add(read_, data, size); }
+    // Adds whole bursts of write data, throws std::invalid_argument if size is no multiple of the burst size
+    void addWrite(const std::uint8_t* data, std::size_t size) { add(write_, data, size); }
+
+    std::uint64_t readBursts() const noexcept { return read_.bursts; }
+    std::uint64_t writeBursts() const noexcept { return write_.bursts; }
+    std::size_t burstBytes() const noexcept { return burstBytes_; }
+
+    void reset() noexcept
+    {
+        read_ = {};
+        write_ = {};
+    }
+
+    // Rates of the added bursts, 0 for directions without bursts
+    ToggleRateDefinition toggleRateDefinition(
+        TogglingRateIdlePattern idlePatternRead = TogglingRateIdlePattern::L,
+        TogglingRateIdlePattern idlePatternWrite = TogglingRateIdlePattern::L) const noexcept
+    {
+        ToggleRateDefinition definition{};
+        definition.togglingRateRead = togglingRate(read_);
+        definition.togglingRateWrite = togglingRate(write_);
+        definition.dutyCycleRead = dutyCycle(read_);
+        definition.dutyCycleWrite = dutyCycle(write_);
+        definition.idlePatternRead = idlePatternRead;
+        definition.idlePatternWrite = idlePatternWrite;
+        return definition;
+    }
+
+private:
+    struct Counts
+    {
+        std::uint64_t bursts = 0;
+        std::uint64_t ones = 0;
+        std::uint64_t toggles = 0;
+    };
+
+    void add(Counts& counts, const std::uint8_t* data, std::size_t size)
+    {
+        if (size % burstBytes_ != 0)
+            throw std::invalid_argument("ToggleRateEstimator: data is no multiple of the burst size");
+        if (size == 0)
+            return;
+
+        const std::size_t bursts = size / burstBytes_;
+        counts.bursts += bursts;
+        counts.ones += detail::popcount_xor(data, nullptr, size);
+
+        // XOR of the whole buffer with itself shifted by one beat, then the transitions
+        // between the last beat of a burst and the first beat of the next burst are removed
+        std::uint64_t toggles = detail::popcount_xor(data, data + beatBytes_, size - beatBytes_);
+        for (std::size_t burst = 1; burst < bursts; ++burst)
+        {
+            const std::uint8_t* first = data + burst * burstBytes_;
+            toggles -= detail::popcount_xor_scalar(first - beatBytes_, first, beatBytes_);
+        }
+        counts.toggles += toggles;
+    }
+
+    double togglingRate(const Counts& counts) const noexcept
+    {
+        const double transitions = static_cast<double>(counts.bursts * (burstLength_ - 1) * beatBytes_ * 8);
+        return transitions > 0 ? static_cast<double>(counts.toggles) / transitions : 0.0;
+    }
+
+    double dutyCycle(const Counts& counts) const noexcept
+    {
+        const double bits = static_cast<double>(counts.bursts * burstBytes_ * 8);
+        return bits > 0 ? static_cast<double>(counts.ones) / bits : 0.0;
+    }
+
+    std::size_t beatBytes_;
+    std::size_t burstBytes_;
+    std::uint64_t burstLength_;
+    Counts read_;
+    Counts write_;
+};
+
+} // namespace DRAMUtils::Config
+
+#endif /* DRAMUTILS_CONFIG_TOGGLING_RATE_ESTIMATOR_H */
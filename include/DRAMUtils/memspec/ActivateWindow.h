@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_MEMSPEC_ACTIVATEWINDOW_H
+#define DRAMUTILS_MEMSPEC_ACTIVATEWINDOW_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace DRAMUtils::MemSpec
+{
+
+/**
+ * @brief Fixed capacity ring buffer of the last Activates activates of a rank, for the four
+ *        activate window (tFAW). A window of 0 does not constrain activates.
+ *        Neither recording an activate nor querying the earliest next activate branches.
+ */
+template <std::size_t Activates = 4>
+class ActivateWindow
+{
+    static_assert(Activates > 0 && (Activates & (Activates - 1)) == 0, "Activates must be a power of two");
+
+public:
+    explicit ActivateWindow(std::uint64_t window = 0) noexcept :
+        window_(window),
+        offset_(window != 0 ? static_cast<std::int64_t>(window) : Never)
+    {
+        reset();
+    }
+
+    // Records an activate, times must not decrease
+    void activate(std::uint64_t time) noexcept
+    {
+        times_[head_] = static_cast<std::int64_t>(time);
+        head_ = (head_ + 1) & (Activates - 1);
+    }
+
+    // Earliest time of the next activate, the oldest recorded activate plus the window
+    std::uint64_t earliestNextAct() const noexcept {
+        return static_cast<std::uint64_t>(std::max<std::int64_t>(times_[head_] + offset_, 0));
+    }
+
+    std::uint64_t window() const noexcept { return window_; }
+
+    // Forgets all activates
+    void reset() noexcept
+    {
+        times_.fill(Never);
+        head_ = 0;
+    }
+
+private:
+    // Far enough in the past that no window reaches 0, Never + Never does not overflow
+    static constexpr std::int64_t Never = std::numeric_limits<std::int64_t>::min() / 2;
+
+    std::array<std::int64_t, Activates> times_;
+    std::size_t head_ = 0;
+    std::uint64_t window_;
+    std::int64_t offset_;
+};
+
+/**
+ * @brief Activate windows of a physical rank with several logical ranks (3DS), e.g. DDR5 with
+ *        tFAW_slr for activates to the same logical rank and tFAW_dlr for activates of all
+ *        logical ranks of the physical rank.
+ */
+class LogicalRankActivateWindow
+{
+public:
+    // Throws std::invalid_argument if logicalRanks is 0
+    LogicalRankActivateWindow(std::size_t logicalRanks, std::uint64_t windowSameLogicalRank, std::uint64_t windowDifferentLogicalRank) :
+        sameLogicalRank_(logicalRanks, ActivateWindow<>(windowSameLogicalRank)),
+        physicalRank_(windowDifferentLogicalRank)
+    {
+        if (logicalRanks == 0)
+            throw std::invalid_argument("LogicalRankActivateWindow: logicalRanks must not be 0");
+    }
+
+    void activate(std::size_t logicalRank, std::uint64_t time) noexcept
+    {
+        sameLogicalRank_[logicalRank].activate(time);
+        physicalRank_.activate(time);
+    }
+
+    std::uint64_t earliestNextAct(std::size_t logicalRank) const noexcept {
+        return std::max(sameLogicalRank_[logicalRank].earliestNextAct(), physicalRank_.earliestNextAct());
+    }
+
+    std::size_t logicalRanks() const noexcept { return sameLogicalRank_.size(); }
+
+    void reset() noexcept
+    {
+        for (auto& window : sameLogicalRank_)
+            window.reset();
+        physicalRank_.reset();
+    }
+
+private:
+    std::vector<ActivateWindow<>> sameLogicalRank_;
+    ActivateWindow<> physicalRank_;
+};
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_ACTIVATEWINDOW_H */
@@ -38,9 +38,18 @@
 
 #include <string_view>
 
+#include "DRAMUtils/util/fixed_string.h"
+
 struct BaseMemSpec
 {
     //std::string memoryType;
 };
 
+namespace DRAMUtils::MemSpec {
+
+// Type of the memoryId of the standards. The fixed capacity keeps the standards literal types.
+using MemoryId = util::FixedString<63>;
+
+} // namespace DRAMUtils::MemSpec
+
 #endif /* DRAMUTILS_MEMSPEC_BASEMEMSPEC_H */
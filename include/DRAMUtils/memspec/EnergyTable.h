@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_MEMSPEC_ENERGYTABLE_H
+#define DRAMUTILS_MEMSPEC_ENERGYTABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace DRAMUtils::MemSpec
+{
+
+// Commands with a fixed energy cost
+enum class EnergyCommand : std::size_t
+{
+    ACT,
+    PRE,
+    RD,
+    WR,
+    REF,    // All bank refresh
+    REFPB,  // Per bank (LPDDR4, LPDDR5) or same bank (DDR5) refresh, 0 if not supported
+    Count
+};
+
+// Background states with a constant power
+enum class BackgroundState : std::size_t
+{
+    PrechargeStandby,
+    ActiveStandby,
+    PrechargePowerDown,
+    ActivePowerDown,
+    SelfRefresh,
+    Count
+};
+
+/**
+ * @brief Immutable table of the command energies in J and the background powers in W of a single
+ *        device, indexed by EnergyCommand and BackgroundState.
+ *        Command energies only contain the current above the background current of the state
+ *        the command is issued in (IDD3N, or IDD2N for PRE), as in the DRAMPower model.
+ *        Tables are created with make_energy_table(const MemSpec<Standard>&) for DDR4, DDR5,
+ *        LPDDR4 and LPDDR5.
+ */
+class EnergyTable
+{
+public:
+    static constexpr std::size_t commands = static_cast<std::size_t>(EnergyCommand::Count);
+    static constexpr std::size_t states = static_cast<std::size_t>(BackgroundState::Count);
+    using Energies = std::array<double, commands>;
+    using Powers = std::array<double, states>;
+
+    EnergyTable(double tCK, const Energies& energies, const Powers& powers) noexcept :
+        tCK_(tCK),
+        energies_(energies),
+        powers_(powers)
+    {}
+
+    double energy(EnergyCommand command) const noexcept {
+        return energies_[static_cast<std::size_t>(command)];
+    }
+
+    double power(BackgroundState state) const noexcept {
+        return powers_[static_cast<std::size_t>(state)];
+    }
+
+    // Energy of staying cycles clock cycles in the background state
+    double backgroundEnergy(BackgroundState state, std::uint64_t cycles) const noexcept {
+        return power(state) * static_cast<double>(cycles) * tCK_;
+    }
+
+    double tCK() const noexcept { return tCK_; }
+
+    const Energies& allEnergies() const noexcept { return energies_; }
+    const Powers& allPowers() const noexcept { return powers_; }
+
+private:
+    double tCK_;
+    Energies energies_;
+    Powers powers_;
+};
+
+namespace detail
+{
+
+// Currents in A of one supply rail with voltage vdd in V
+struct EnergyRail
+{
+    double vdd;
+    double idd0;
+    double idd2n;
+    double idd3n;
+    double idd4r;
+    double idd4w;
+    double idd5;
+    double idd5pb;
+    double idd2p;
+    double idd3p;
+    double idd6;
+};
+
+// Command durations in clock cycles
+struct EnergyTimings
+{
+    double tCK;
+    std::uint64_t RAS;
+    std::uint64_t RP;
+    std::uint64_t RFC;
+    std::uint64_t RFCpb;
+    std::uint64_t burstCycles;
+};
+
+constexpr std::uint64_t burst_cycles(std::uint64_t burstLength, std::uint64_t dataRate) noexcept
+{
+    return dataRate != 0 ? burstLength / dataRate : 0;
+}
+
+template <std::size_t N>
+EnergyTable make_energy_table(const std::array<EnergyRail, N>& rails, const EnergyTimings& t) noexcept
+{
+    EnergyTable::Energies energies{};
+    EnergyTable::Powers powers{};
+
+    const auto add = [](auto& values, auto index, double value) {
+        values[static_cast<std::size_t>(index)] += value;
+    };
+    const auto cycles = [&t](std::uint64_t n) { return static_cast<double>(n) * t.tCK; };
+
+    for (const auto& rail : rails)
+    {
+        add(energies, EnergyCommand::ACT, rail.vdd * (rail.idd0 - rail.idd3n) * cycles(t.RAS));
+        add(energies, EnergyCommand::PRE, rail.vdd * (rail.idd0 - rail.idd2n) * cycles(t.RP));
+        add(energies, EnergyCommand::RD, rail.vdd * (rail.idd4r - rail.idd3n) * cycles(t.burstCycles));
+        add(energies, EnergyCommand::WR, rail.vdd * (rail.idd4w - rail.idd3n) * cycles(t.burstCycles));
+        add(energies, EnergyCommand::REF, rail.vdd * (rail.idd5 - rail.idd3n) * cycles(t.RFC));
+        add(energies, EnergyCommand::REFPB, rail.vdd * (rail.idd5pb - rail.idd3n) * cycles(t.RFCpb));
+
+        add(powers, BackgroundState::PrechargeStandby, rail.vdd * rail.idd2n);
+        add(powers, BackgroundState::ActiveStandby, rail.vdd * rail.idd3n);
+        add(powers, BackgroundState::PrechargePowerDown, rail.vdd * rail.idd2p);
+        add(powers, BackgroundState::ActivePowerDown, rail.vdd * rail.idd3p);
+        add(powers, BackgroundState::SelfRefresh, rail.vdd * rail.idd6);
+    }
+    return EnergyTable(t.tCK, energies, powers);
+}
+
+} // namespace detail
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_ENERGYTABLE_H */
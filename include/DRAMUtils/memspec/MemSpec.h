@@ -36,15 +36,22 @@
 #ifndef DRAMUTILS_MEMSPEC_MEMSPEC_H
 #define DRAMUTILS_MEMSPEC_MEMSPEC_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <variant>
-#include <iostream>
+#include <vector>
 #include <filesystem>
-#include <fstream>
+#include <iosfwd>
 #include <optional>
 #include <string_view>
 
+#include "DRAMUtils/util/content_hash.h"
+#include "DRAMUtils/util/expected.h"
 #include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/util/parse_status.h"
 #include "DRAMUtils/util/types.h"
 #include "DRAMUtils/util/id_variant.h"
 
@@ -91,6 +98,28 @@ struct MemSpecContainer
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemSpecContainer, memspec)
 
+namespace detail
+{
+
+template <typename T, typename = void>
+struct has_constraint_matrix : std::false_type {};
+
+template <typename T>
+struct has_constraint_matrix<T, std::void_t<decltype(make_constraint_matrix(std::declval<const T&>()))>> : std::true_type {};
+
+} // namespace detail
+
+// Timing checker of the standard held by memspec, std::nullopt if the standard has no constraint matrix
+inline std::optional<TimingChecker> make_timing_checker(const MemSpecVariant& memspec)
+{
+    return std::visit([](const auto& spec) -> std::optional<TimingChecker> {
+        if constexpr (detail::has_constraint_matrix<std::decay_t<decltype(spec)>>::value)
+            return make_timing_checker(spec);
+        else
+            return std::nullopt;
+    }, memspec.getVariant());
+}
+
 } // namespace DRAMUtils::MemSpec
 
 namespace DRAMUtils {
@@ -102,15 +131,35 @@ struct keys
     static constexpr char memSpec[] = "memspec";
 };
 
+} // namespace detail
+
+// Binary formats supported for MemSpec serialization
+enum class BinaryFormat
+{
+    CBOR,
+    MessagePack,
 };
 
 /**
- * @brief Parses Memspec from JSON data into a MemSpecVariant object.
+ * @brief Parses Memspec from JSON data into a MemSpecVariant object without throwing.
+ * 
+ * This function first checks if the provided key exists in the JSON object; if found, it
+ * parses the corresponding JSON value into the MemSpecVariant. If no key is provided, the key
+ * is not found or the value under the key has no known "memoryType", it attempts to parse the
+ * entire JSON object directly.
+ * 
+ * @param json The json object containing the MemSpec data
+ * @param result The MemSpecVariant object the MemSpec is written to
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *            Defaults to "memspec" if not provided.
  * 
- * This function attempts to parse a MemSpecVariant object from JSON data. It first
- * checks if the provided key exists in the JSON object; if found, it tries to extract
- * and parse the corresponding JSON value into the MemSpecVariant. If no key is provided
- * or the key is not found, it attempts to parse the entire JSON object directly.
+ * @return util::ParseStatus::Ok if the JSON data was successfully parsed or the cause of the failure otherwise.
+ */
+DRAMUTILS_INLINE util::ParseStatus parse_memspec_from_json(const json_t& json, MemSpec::MemSpecVariant& result, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from JSON data into a MemSpecVariant object.
+ *        This function is a wrapper around the non-throwing parse_memspec_from_json.
  * 
  * @param json The json object containing the MemSpec data
  * @param key Optional key to locate the MemSpec data in the json object.
@@ -118,23 +167,7 @@ struct keys
  * 
  * @return An optional MemSpecVariant object if the JSON data was successfully parsed or std::nullopt otherwise.
  */
-inline std::optional<MemSpec::MemSpecVariant> parse_memspec_from_json(const json_t& json, std::string_view key = detail::keys::memSpec)
-{
-    try
-    {
-        MemSpec::MemSpecVariant result;
-        if (!key.empty() && json.contains(key) && result.from_json(json.at(key)))
-            return result;
-        else if (result.from_json(json))
-            return result;
-    }
-    catch (std::exception&)
-    {
-        return std::nullopt;
-    }
-
-    return std::nullopt;
-}
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_json(const json_t& json, std::string_view key = detail::keys::memSpec);
 
 /**
  * @brief Parses Memspec from a string buffer into a MemSpecVariant object.
@@ -146,17 +179,7 @@ inline std::optional<MemSpec::MemSpecVariant> parse_memspec_from_json(const json
  * 
  * @return An optional MemSpecVariant object if the JSON data was successfully parsed or std::nullopt otherwise.
  */
-inline std::optional<MemSpec::MemSpecVariant> parse_Memspec_from_buffer(std::string_view buffer, std::string_view key = detail::keys::memSpec)
-{
-    try
-    {
-        return parse_memspec_from_json(json_t::parse(buffer), key);
-    }
-    catch (std::exception&)
-    {
-        return std::nullopt;
-    }
-}
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_Memspec_from_buffer(std::string_view buffer, std::string_view key = detail::keys::memSpec);
 
 /**
  * @brief Parses Memspec from a file into a MemSpecVariant object.
@@ -168,26 +191,219 @@ inline std::optional<MemSpec::MemSpecVariant> parse_Memspec_from_buffer(std::str
  * 
  * @return An optional MemSpecVariant object if the JSON data was successfully parsed or std::nullopt otherwise.
  */
-inline std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file(const std::filesystem::path &path, std::string_view key = detail::keys::memSpec)
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file(const std::filesystem::path &path, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a string buffer into a MemSpecVariant object without building
+ *        an intermediate json object and without throwing. The fields are written directly
+ *        into the standard selected by the "memoryType" field. The key lookup matches
+ *        parse_memspec_from_json.
+ * 
+ * @param buffer The string buffer containing the MemSpec data
+ * @param result The MemSpecVariant object the MemSpec is written to
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return util::ParseStatus::Ok if the JSON data was successfully parsed or the cause of the failure otherwise.
+ */
+DRAMUTILS_INLINE util::ParseStatus parse_memspec_from_buffer_sax(std::string_view buffer, MemSpec::MemSpecVariant& result, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a string buffer into a MemSpecVariant object.
+ *        This function is a wrapper around the non-throwing parse_memspec_from_buffer_sax.
+ * 
+ * @param buffer The string buffer containing the MemSpec data
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return An optional MemSpecVariant object if the JSON data was successfully parsed or std::nullopt otherwise.
+ */
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_buffer_sax(std::string_view buffer, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a file into a MemSpecVariant object.
+ *       This function is a wrapper around parse_memspec_from_buffer_sax.
+ * 
+ * @param path The path to the file containing the MemSpec data
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *          Defaults to "memspec" if not provided.
+ * 
+ * @return An optional MemSpecVariant object if the JSON data was successfully parsed or std::nullopt otherwise.
+ */
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file_sax(const std::filesystem::path &path, std::string_view key = detail::keys::memSpec);
+
+// Parsed MemSpec or the cause of the failure
+using MemSpecResult = util::Expected<MemSpec::MemSpecVariant, util::ParseError>;
+
+/**
+ * @brief Parses Memspec from a json object like parse_memspec_from_json and reports the cause
+ *        of a failure. The error report is only built if parsing fails.
+ * 
+ * @param json The JSON object containing the MemSpec data
+ * @param key Optional key to locate the MemSpec data in the JSON object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return The MemSpecVariant or a util::ParseError with the status, the JSON pointer of the
+ *         invalid value, the expected type and the standard being parsed.
+ */
+DRAMUTILS_INLINE MemSpecResult parse_memspec_from_json_checked(const json_t& json, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a string buffer like parse_memspec_from_buffer_sax and reports
+ *        the cause of a failure. The error report is only built if parsing fails.
+ * 
+ * @param buffer The string buffer containing the MemSpec data
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return The MemSpecVariant or a util::ParseError with the status, the JSON pointer of the
+ *         invalid value, the expected type and the standard being parsed.
+ */
+DRAMUTILS_INLINE MemSpecResult parse_memspec_from_buffer_checked(std::string_view buffer, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a file like parse_memspec_from_file_sax and reports the cause of
+ *        a failure. Files that cannot be read are reported as util::ParseStatus::FileError.
+ * 
+ * @param path The path to the file containing the MemSpec data
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *          Defaults to "memspec" if not provided.
+ * 
+ * @return The MemSpecVariant or a util::ParseError.
+ */
+DRAMUTILS_INLINE MemSpecResult parse_memspec_from_file_checked(const std::filesystem::path &path, std::string_view key = detail::keys::memSpec);
+
+// Result of parsing a single file of parse_memspecs_from_directory
+struct MemSpecFileResult
 {
-    try
-    {
-        if (!std::filesystem::exists(path))
-            return std::nullopt;
+    std::filesystem::path path;
+    util::ParseStatus status = util::ParseStatus::FileError;
+    MemSpec::MemSpecVariant memspec; // Only valid if status is util::ParseStatus::Ok
+    util::ParseError error;          // Cause of the failure if status is not util::ParseStatus::Ok
+};
 
-        std::ifstream file(path);
-        if (!file.is_open())
-            return std::nullopt;
+/**
+ * @brief Parses all MemSpec files (*.json) in a directory and its subdirectories in parallel.
+ *        The files are parsed with parse_memspec_from_file_checked by a pool of threads.
+ * 
+ * @param directory The directory containing the MemSpec files
+ * @param threads Number of threads used for parsing. Defaults to the number of hardware threads if 0.
+ * @param key Optional key to locate the MemSpec data in the json objects.
+ *          Defaults to "memspec" if not provided.
+ * 
+ * @return One result per file, sorted by path. The status and error of a result report why
+ *         the file could not be parsed. The result is empty if the directory cannot be read.
+ */
+DRAMUTILS_INLINE std::vector<MemSpecFileResult> parse_memspecs_from_directory(const std::filesystem::path &directory, std::size_t threads = 0, std::string_view key = detail::keys::memSpec);
 
-        json_t json_obj = json_t::parse(file);
-        return parse_memspec_from_json(json_obj, key);
-    }
-    catch (std::exception&)
-    {
-        return std::nullopt;
-    }
-}
+/**
+ * @brief Parses Memspec from a binary buffer into a MemSpecVariant object without throwing.
+ *        The binary data is read by the SAX parser, no intermediate json object is built.
+ * 
+ * @param buffer The buffer containing the MemSpec data
+ * @param result The MemSpecVariant object the MemSpec is written to
+ * @param format The binary format of the buffer
+ * @param key Optional key to locate the MemSpec data in the binary object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return util::ParseStatus::Ok if the data was successfully parsed or the cause of the failure otherwise.
+ */
+DRAMUTILS_INLINE util::ParseStatus parse_memspec_from_binary(const std::vector<std::uint8_t>& buffer, MemSpec::MemSpecVariant& result, BinaryFormat format, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a CBOR buffer into a MemSpecVariant object.
+ * 
+ * @param buffer The buffer containing the CBOR encoded MemSpec data
+ * @param key Optional key to locate the MemSpec data in the binary object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return An optional MemSpecVariant object if the data was successfully parsed or std::nullopt otherwise.
+ */
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_cbor(const std::vector<std::uint8_t>& buffer, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a MessagePack buffer into a MemSpecVariant object.
+ * 
+ * @param buffer The buffer containing the MessagePack encoded MemSpec data
+ * @param key Optional key to locate the MemSpec data in the binary object.
+ *           Defaults to "memspec" if not provided.
+ * 
+ * @return An optional MemSpecVariant object if the data was successfully parsed or std::nullopt otherwise.
+ */
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_msgpack(const std::vector<std::uint8_t>& buffer, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Serializes a MemSpecVariant object into a binary buffer.
+ * 
+ * @param memspec The MemSpecVariant object
+ * @param format The binary format of the buffer
+ * @param key Optional key the MemSpec data is stored under.
+ *           Defaults to "memspec" if not provided. If empty, the MemSpec is the root object.
+ * 
+ * @return The encoded MemSpec.
+ */
+DRAMUTILS_INLINE std::vector<std::uint8_t> write_memspec_to_binary(const MemSpec::MemSpecVariant& memspec, BinaryFormat format, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Serializes a MemSpecVariant object into a CBOR buffer.
+ *        This function is a wrapper around write_memspec_to_binary.
+ */
+DRAMUTILS_INLINE std::vector<std::uint8_t> write_memspec_to_cbor(const MemSpec::MemSpecVariant& memspec, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Serializes a MemSpecVariant object into a MessagePack buffer.
+ *        This function is a wrapper around write_memspec_to_binary.
+ */
+DRAMUTILS_INLINE std::vector<std::uint8_t> write_memspec_to_msgpack(const MemSpec::MemSpecVariant& memspec, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Writes a MemSpecVariant object as JSON text without building a json object.
+ *        Fields are written in declaration order, the memoryType comes first.
+ *        The text parses to the same json value as the json conversion of the MemSpecVariant.
+ * 
+ * @param out The text is appended to out
+ * @param memspec The MemSpecVariant object
+ * @param indent Indentation as in json_t::dump, compact text if negative
+ * @param key Optional key the MemSpec data is stored under.
+ *           Defaults to "memspec" if not provided. If empty, the MemSpec is the root object.
+ */
+DRAMUTILS_INLINE void write_memspec_to_json(std::string& out, const MemSpec::MemSpecVariant& memspec, int indent = -1, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Writes a MemSpecVariant object as JSON text to a stream without building a json object.
+ *        See write_memspec_to_json(std::string&, ...).
+ */
+DRAMUTILS_INLINE void write_memspec_to_json(std::ostream& out, const MemSpec::MemSpecVariant& memspec, int indent = -1, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Writes a MemSpecVariant object as JSON text into a fixed buffer without allocating.
+ *        See write_memspec_to_json(std::string&, ...). The text is not null terminated.
+ * 
+ * @return The length of the full text. Only the first size characters are written, the text
+ *         is complete if the length does not exceed size.
+ */
+DRAMUTILS_INLINE std::size_t write_memspec_to_json(char* buffer, std::size_t size, const MemSpec::MemSpecVariant& memspec, int indent = -1, std::string_view key = detail::keys::memSpec);
+
+/**
+ * @brief Parses Memspec from a JSON file and caches the result in a binary sibling file
+ *        (<path>.cbor or <path>.msgpack). The cache is reused as long as the modification
+ *        time, size and hash of the JSON file and the key match the ones stored in the cache.
+ *        Otherwise the JSON file is parsed and the cache is rewritten.
+ * 
+ * @param path The path to the JSON file containing the MemSpec data
+ * @param key Optional key to locate the MemSpec data in the json object.
+ *          Defaults to "memspec" if not provided.
+ * @param format The binary format of the cache file
+ * 
+ * @return An optional MemSpecVariant object if the data was successfully parsed or std::nullopt otherwise.
+ */
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file_cached(const std::filesystem::path &path, std::string_view key = detail::keys::memSpec, BinaryFormat format = BinaryFormat::CBOR);
 
 } // namespace DRAMUtils
 
+// The definitions are compiled into the library in DRAMUTILS_COMPILED mode
+#ifndef DRAMUTILS_COMPILED
+#include "MemSpecImpl.h"
+#endif
+
 #endif /* DRAMUTILS_MEMSPEC_MEMSPEC_H */
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECCATALOGUE_H
+#define DRAMUTILS_MEMSPEC_MEMSPECCATALOGUE_H
+
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+// Compile time catalogue of common JEDEC parts. The values are representative for the speed bin
+// and density of the part, tCK is given in seconds and all timings in clock cycles. Use the
+// memspec of the vendor datasheet where exact numbers matter.
+
+namespace DRAMUtils::MemSpec::Catalogue
+{
+
+namespace detail
+{
+
+constexpr MemSpecDDR4 ddr4_3200_8Gb_x8()
+{
+    MemSpecDDR4 m{};
+    m.memoryId = "JEDEC_8Gb_DDR4-3200_8bit";
+
+    auto& arch = m.memarchitecturespec;
+    arch.nbrOfChannels = 1;
+    arch.nbrOfDevices = 1;
+    arch.nbrOfRanks = 1;
+    arch.nbrOfBanks = 16;
+    arch.nbrOfBankGroups = 4;
+    arch.nbrOfRows = 65536;
+    arch.nbrOfColumns = 1024;
+    arch.burstLength = 8;
+    arch.dataRate = 2;
+    arch.width = 8;
+    arch.RefMode = 1;
+
+    // DDR4-3200AA (22-22-22)
+    auto& t = m.memtimingspec;
+    t.tCK = 0.625e-9;
+    t.CKE = 8;
+    t.CKESR = 9;
+    t.RAS = 52;
+    t.RC = 74;
+    t.RCD = 22;
+    t.RL = 22;
+    t.RPRE = 1;
+    t.RTP = 12;
+    t.WL = 16;
+    t.WPRE = 1;
+    t.WR = 24;
+    t.XP = 10;
+    t.XS = 576;
+    t.REFM = 1;
+    t.REFI = 12480;
+    t.RFC1 = 560;
+    t.RFC2 = 416;
+    t.RFC4 = 256;
+    t.RP = 22;
+    t.DQSCK = 2;
+    t.CCD_S = 4;
+    t.CCD_L = 8;
+    t.FAW = 34;
+    t.RRD_S = 4;
+    t.RRD_L = 8;
+    t.WTR_S = 4;
+    t.WTR_L = 12;
+    t.XPDLL = 39;
+    t.XSDLL = 1024;
+    t.AL = 0;
+    t.ACTPDEN = 2;
+    t.PRPDEN = 2;
+    t.REFPDEN = 2;
+    t.RTRS = 1;
+
+    auto& p = m.mempowerspec;
+    p.vdd = 1.2;
+    p.idd0 = 0.058;
+    p.idd2n = 0.037;
+    p.idd3n = 0.052;
+    p.idd4r = 0.160;
+    p.idd4w = 0.150;
+    p.idd6n = 0.030;
+    p.idd2p = 0.025;
+    p.idd3p = 0.037;
+    p.vpp = 2.5;
+    p.ipp0 = 0.004;
+    p.ipp2n = 0.003;
+    p.ipp3n = 0.003;
+    p.ipp4r = 0.003;
+    p.ipp4w = 0.003;
+    p.ipp6n = 0.005;
+    p.ipp2p = 0.003;
+    p.ipp3p = 0.003;
+    p.idd5B = 0.250;
+    p.ipp5B = 0.030;
+    p.idd5F2 = 0.220;
+    p.ipp5F2 = 0.025;
+    p.idd5F4 = 0.190;
+    p.ipp5F4 = 0.020;
+    p.vddq = 1.2;
+
+    auto& z = m.memimpedancespec;
+    z.C_total_ck = 1.0e-12;
+    z.C_total_cb = 1.0e-12;
+    z.C_total_rb = 1.5e-12;
+    z.C_total_wb = 1.5e-12;
+    z.C_total_dqs = 1.5e-12;
+    z.R_eq_ck = 40.0;
+    z.R_eq_cb = 40.0;
+    z.R_eq_rb = 40.0;
+    z.R_eq_wb = 40.0;
+    z.R_eq_dqs = 40.0;
+
+    auto& pp = m.prepostamble;
+    pp.read_zeroes = 1;
+    pp.write_zeroes = 1;
+    pp.read_ones = 0;
+    pp.write_ones = 0;
+    pp.read_zeroes_to_ones = 1;
+    pp.write_zeroes_to_ones = 1;
+    pp.write_ones_to_zeroes = 1;
+    pp.read_ones_to_zeroes = 1;
+    pp.readMinTccd = 5;
+    pp.writeMinTccd = 5;
+    return m;
+}
+
+constexpr MemSpecDDR5 ddr5_4800_16Gb_x4()
+{
+    MemSpecDDR5 m{};
+    m.memoryId = "JEDEC_16Gb_DDR5-4800_4bit";
+
+    auto& arch = m.memarchitecturespec;
+    arch.nbrOfChannels = 1;
+    arch.nbrOfDevices = 1;
+    arch.nbrOfRanks = 1;
+    arch.nbrOfDIMMRanks = 1;
+    arch.nbrOfPhysicalRanks = 1;
+    arch.nbrOfLogicalRanks = 1;
+    arch.nbrOfBanks = 32;
+    arch.nbrOfBankGroups = 8;
+    arch.nbrOfRows = 65536;
+    arch.nbrOfColumns = 2048;
+    arch.burstLength = 16;
+    arch.dataRate = 2;
+    arch.width = 4;
+    arch.RefMode = 1;
+    arch.cmdMode = 1;
+    arch.RAAIMT = 32;
+    arch.RAAMMT = 96;
+    arch.RAADEC = 1;
+
+    // DDR5-4800B (40-39-39), single logical rank, so the dlr/dpr refresh timings are unused
+    auto& t = m.memtimingspec;
+    t.tCK = 0.416e-9;
+    t.RAS = 77;
+    t.RCD = 39;
+    t.RTP = 18;
+    t.WL = 38;
+    t.WR = 72;
+    t.RP = 39;
+    t.PPD = 2;
+    t.RL = 40;
+    t.RPRE = 1;
+    t.RPST = 0;
+    t.RDDQS = 1;
+    t.WPRE = 2;
+    t.WPST = 0;
+    t.CCD_L_slr = 12;
+    t.CCD_L_WR_slr = 48;
+    t.CCD_L_WR2_slr = 24;
+    t.CCD_M_slr = 8;
+    t.CCD_M_WR_slr = 32;
+    t.CCD_S_slr = 8;
+    t.CCD_S_WR_slr = 8;
+    t.CCD_dlr = 8;
+    t.CCD_WR_dlr = 8;
+    t.CCD_WR_dpr = 8;
+    t.RRD_L_slr = 12;
+    t.RRD_S_slr = 8;
+    t.RRD_dlr = 4;
+    t.FAW_slr = 32;
+    t.FAW_dlr = 16;
+    t.WTR_L = 24;
+    t.WTR_M = 16;
+    t.WTR_S = 6;
+    t.RFC1_slr = 710;
+    t.RFC2_slr = 385;
+    t.RFCsb_slr = 313;
+    t.REFI1 = 9375;
+    t.REFI2 = 4688;
+    t.REFISB = 2344;
+    t.REFSBRD_slr = 72;
+    t.RTRS = 2;
+    t.CPDED = 8;
+    t.PD = 18;
+    t.XP = 18;
+    t.ACTPDEN = 2;
+    t.PRPDEN = 2;
+    t.REFPDEN = 2;
+
+    auto& p = m.mempowerspec;
+    p.vdd = 1.1;
+    p.idd0 = 0.061;
+    p.idd2n = 0.046;
+    p.idd3n = 0.062;
+    p.idd4r = 0.170;
+    p.idd4w = 0.180;
+    p.idd5c = 0.110;
+    p.idd6n = 0.035;
+    p.idd2p = 0.043;
+    p.idd3p = 0.056;
+    p.vpp = 1.8;
+    p.ipp0 = 0.0045;
+    p.ipp2n = 0.0035;
+    p.ipp3n = 0.0035;
+    p.ipp4r = 0.0036;
+    p.ipp4w = 0.0036;
+    p.ipp5c = 0.0070;
+    p.ipp6n = 0.0040;
+    p.ipp2p = 0.0035;
+    p.ipp3p = 0.0035;
+    p.idd5b = 0.300;
+    p.idd5f = 0.250;
+    p.ipp5b = 0.025;
+    p.ipp5f = 0.020;
+    p.vddq = 1.1;
+
+    auto& z = m.memimpedancespec;
+    z.C_total_cb = 1.0e-12;
+    z.C_total_ck = 1.0e-12;
+    z.C_total_dqs = 1.5e-12;
+    z.C_total_rb = 1.5e-12;
+    z.C_total_wb = 1.5e-12;
+    z.R_eq_cb = 40.0;
+    z.R_eq_ck = 40.0;
+    z.R_eq_dqs = 40.0;
+    z.R_eq_rb = 40.0;
+    z.R_eq_wb = 40.0;
+    return m;
+}
+
+constexpr MemSpecLPDDR5 lpddr5_6400_16Gb_x16()
+{
+    MemSpecLPDDR5 m{};
+    m.memoryId = "JEDEC_16Gb_LPDDR5-6400_16bit";
+
+    // 4:1 WCK to CK ratio, 8 data beats per CK
+    auto& arch = m.memarchitecturespec;
+    arch.nbrOfDevices = 1;
+    arch.nbrOfChannels = 1;
+    arch.nbrOfRanks = 1;
+    arch.nbrOfBanks = 16;
+    arch.nbrOfBankGroups = 4;
+    arch.nbrOfRows = 65536;
+    arch.nbrOfColumns = 1024;
+    arch.burstLength = 16;
+    arch.dataRate = 8;
+    arch.width = 16;
+    arch.per2BankOffset = 8;
+    arch.WCKalwaysOn = true;
+
+    auto& t = m.memtimingspec;
+    t.tCK = 1.25e-9;
+    t.REFI = 3124;
+    t.REFIpb = 390;
+    t.RFCab = 224;
+    t.RFCpb = 112;
+    t.RAS = 34;
+    t.RPab = 17;
+    t.RPpb = 15;
+    t.RCpb = 49;
+    t.RCab = 51;
+    t.PPD = 2;
+    t.RCD_L = 15;
+    t.RCD_S = 15;
+    t.FAW = 16;
+    t.RRD = 4;
+    t.RL = 17;
+    t.RBTP = 4;
+    t.WL = 9;
+    t.WR = 28;
+    t.RTRS = 1;
+    t.BL_n_min_16 = 2;
+    t.BL_n_max_16 = 4;
+    t.BL_n_L_16 = 4;
+    t.BL_n_S_16 = 2;
+    t.BL_n_min_32 = 4;
+    t.BL_n_max_32 = 8;
+    t.BL_n_L_32 = 8;
+    t.BL_n_S_32 = 2;
+    t.WTR_L = 10;
+    t.WTR_S = 5;
+    t.WCK2DQO = 2;
+    t.WCK2CK = 0;
+    t.pbR2act = 6;
+    t.pbR2pbR = 72;
+
+    auto& p = m.mempowerspec;
+    p.vdd1 = 1.8;
+    p.idd01 = 0.0050;
+    p.idd2n1 = 0.0010;
+    p.idd3n1 = 0.0015;
+    p.idd4r1 = 0.0050;
+    p.idd4w1 = 0.0050;
+    p.idd51 = 0.0200;
+    p.idd5pb1 = 0.0030;
+    p.idd61 = 0.0004;
+    p.idd6ds1 = 0.0002;
+    p.idd2p1 = 0.0006;
+    p.idd3p1 = 0.0010;
+    p.vdd2h = 1.05;
+    p.idd02h = 0.0500;
+    p.idd2n2h = 0.0120;
+    p.idd3n2h = 0.0200;
+    p.idd4r2h = 0.2200;
+    p.idd4w2h = 0.2000;
+    p.idd52h = 0.1500;
+    p.idd5pb2h = 0.0300;
+    p.idd62h = 0.0008;
+    p.idd6ds2h = 0.0004;
+    p.idd2p2h = 0.0020;
+    p.idd3p2h = 0.0060;
+    p.vdd2l = 0.9;
+    p.idd02l = 0.0050;
+    p.idd2n2l = 0.0030;
+    p.idd3n2l = 0.0040;
+    p.idd4r2l = 0.0600;
+    p.idd4w2l = 0.0700;
+    p.idd52l = 0.0050;
+    p.idd5pb2l = 0.0040;
+    p.idd62l = 0.0003;
+    p.idd6ds2l = 0.0002;
+    p.idd2p2l = 0.0010;
+    p.idd3p2l = 0.0020;
+    p.vddq = 0.5;
+
+    auto& z = m.memimpedancespec;
+    z.C_total_cb = 0.5e-12;
+    z.C_total_ck = 0.5e-12;
+    z.C_total_wck = 0.5e-12;
+    z.C_total_dqs = 0.5e-12;
+    z.C_total_rb = 0.8e-12;
+    z.C_total_wb = 0.8e-12;
+    z.R_eq_cb = 48.0;
+    z.R_eq_ck = 48.0;
+    z.R_eq_wck = 48.0;
+    z.R_eq_dqs = 48.0;
+    z.R_eq_rb = 48.0;
+    z.R_eq_wb = 48.0;
+    return m;
+}
+
+constexpr MemSpecHBM3 hbm3_6400_16Gb()
+{
+    MemSpecHBM3 m{};
+    m.memoryId = "JEDEC_16Gb_HBM3-6400";
+
+    // 16 channels with 2 pseudo channels of 32 bit each
+    auto& arch = m.memarchitecturespec;
+    arch.nbrOfRows = 16384;
+    arch.nbrOfColumns = 64;
+    arch.burstLength = 8;
+    arch.dataRate = 4;
+    arch.width = 32;
+    arch.nbrOfChannels = 16;
+    arch.nbrOfPseudoChannels = 2;
+    arch.nbrOfDevices = 1;
+    arch.nbrOfBanks = 16;
+    arch.nbrOfBankGroups = 4;
+    arch.RAAIMT = 16;
+    arch.RAAMMT = 48;
+    arch.RAADEC = 1;
+
+    auto& t = m.memtimingspec;
+    t.tCK = 0.625e-9;
+    t.DQSCK = 1;
+    t.RC = 77;
+    t.RAS = 53;
+    t.RCDRD = 26;
+    t.RCDWR = 16;
+    t.RRDL = 7;
+    t.RRDS = 4;
+    t.FAW = 26;
+    t.RTP = 8;
+    t.RP = 26;
+    t.RL = 30;
+    t.WL = 10;
+    t.PL = 0;
+    t.WR = 26;
+    t.CCDL = 4;
+    t.CCDS = 2;
+    t.WTRL = 15;
+    t.WTRS = 5;
+    t.RTW = 18;
+    t.XP = 13;
+    t.CKE = 13;
+    t.XS = 576;
+    t.RFC = 560;
+    t.RFCPB = 256;
+    t.RREFD = 13;
+    t.REFI = 6240;
+    t.REFIPB = 390;
+    t.PPD = 2;
+    return m;
+}
+
+} // namespace detail
+
+inline constexpr MemSpecDDR4 DDR4_3200_8Gb_x8 = detail::ddr4_3200_8Gb_x8();
+inline constexpr MemSpecDDR5 DDR5_4800_16Gb_x4 = detail::ddr5_4800_16Gb_x4();
+inline constexpr MemSpecLPDDR5 LPDDR5_6400_16Gb_x16 = detail::lpddr5_6400_16Gb_x16();
+inline constexpr MemSpecHBM3 HBM3_6400_16Gb = detail::hbm3_6400_16Gb();
+
+// All parts of the catalogue
+inline constexpr auto parts = std::make_tuple(
+    &DDR4_3200_8Gb_x8,
+    &DDR5_4800_16Gb_x4,
+    &LPDDR5_6400_16Gb_x16,
+    &HBM3_6400_16Gb
+);
+
+/**
+ * @brief Finds the part of the standard T with the given memoryId at compile time.
+ * 
+ * @return A pointer to the part or nullptr if the catalogue has no such part of the standard T.
+ */
+template <typename T>
+constexpr const T* find(std::string_view memoryId) noexcept
+{
+    return std::apply([memoryId](const auto*... part) {
+        const T* result = nullptr;
+        ([&](const auto* p) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(*p)>, T>)
+            {
+                if (result == nullptr && p->memoryId == memoryId)
+                    result = p;
+            }
+        }(part), ...);
+        return result;
+    }, parts);
+}
+
+} // namespace DRAMUtils::MemSpec::Catalogue
+
+namespace DRAMUtils
+{
+
+/**
+ * @brief Looks up a part of the built-in catalogue by its memoryId. No file is read and no JSON
+ *        is parsed.
+ * 
+ * @return An optional MemSpecVariant object holding the part or std::nullopt if the memoryId is unknown.
+ */
+inline std::optional<MemSpec::MemSpecVariant> find_builtin_memspec(std::string_view memoryId)
+{
+    return std::apply([memoryId](const auto*... part) {
+        std::optional<MemSpec::MemSpecVariant> result;
+        ([&](const auto* p) {
+            if (!result && p->memoryId == memoryId)
+                result.emplace().setVariant(*p);
+        }(part), ...);
+        return result;
+    }, MemSpec::Catalogue::parts);
+}
+
+} // namespace DRAMUtils
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECCATALOGUE_H */
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECIMPL_H
+#define DRAMUTILS_MEMSPEC_MEMSPECIMPL_H
+
+// Definitions of the functions declared in MemSpec.h. Included by MemSpec.h in header-only mode
+// and compiled into the library in DRAMUTILS_COMPILED mode.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+#include "DRAMUtils/util/hash.h"
+#include "DRAMUtils/util/json_sax.h"
+#include "DRAMUtils/util/json_writer.h"
+#include "DRAMUtils/util/mapped_file.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+namespace DRAMUtils {
+
+namespace detail
+{
+
+inline json_t::input_format_t input_format(BinaryFormat format)
+{
+    return format == BinaryFormat::CBOR ? json_t::input_format_t::cbor : json_t::input_format_t::msgpack;
+}
+
+inline util::ParseStatus parse_memspec_from_json(const json_t& json, MemSpec::MemSpecVariant& result, std::string_view key, util::ParseError* error)
+{
+    // Errors of the keyed lookup are relative to the keyed object
+    const auto keyed = [key](util::ParseError& keyError) {
+        keyError.path.insert(0, "/" + std::string(key));
+        return std::move(keyError);
+    };
+
+    std::optional<util::ParseStatus> keyStatus;
+    util::ParseError keyError;
+    if (!key.empty())
+    {
+        const auto it = json.find(key);
+        if (it != json.end())
+        {
+            keyStatus = util::sax::from_json(*it, result, error ? &keyError : nullptr);
+            if (keyStatus != util::ParseStatus::MissingId && keyStatus != util::ParseStatus::UnknownId)
+            {
+                if (error && keyStatus != util::ParseStatus::Ok)
+                    *error = keyed(keyError);
+                return *keyStatus;
+            }
+        }
+    }
+
+    const util::ParseStatus status = util::sax::from_json(json, result, error);
+    // Report the cause of the keyed lookup if the root object is no MemSpec at all
+    if (keyStatus && status == util::ParseStatus::MissingId)
+    {
+        if (error)
+            *error = keyed(keyError);
+        return *keyStatus;
+    }
+    return status;
+}
+
+} // namespace detail
+
+DRAMUTILS_INLINE util::ParseStatus parse_memspec_from_json(const json_t& json, MemSpec::MemSpecVariant& result, std::string_view key)
+{
+    return detail::parse_memspec_from_json(json, result, key, nullptr);
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_json(const json_t& json, std::string_view key)
+{
+    MemSpec::MemSpecVariant result;
+    if (parse_memspec_from_json(json, result, key) == util::ParseStatus::Ok)
+        return result;
+
+    return std::nullopt;
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_Memspec_from_buffer(std::string_view buffer, std::string_view key)
+{
+    const json_t json = json_t::parse(buffer, nullptr, false);
+    if (json.is_discarded())
+        return std::nullopt;
+
+    return parse_memspec_from_json(json, key);
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file(const std::filesystem::path &path, std::string_view key)
+{
+    try
+    {
+        const util::MappedFile file(path);
+        if (!file.isOpen())
+            return std::nullopt;
+
+        const std::string_view buffer = file.view();
+        const json_t json_obj = json_t::parse(buffer.begin(), buffer.end(), nullptr, false);
+        if (json_obj.is_discarded())
+            return std::nullopt;
+
+        return parse_memspec_from_json(json_obj, key);
+    }
+    catch (std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+DRAMUTILS_INLINE util::ParseStatus parse_memspec_from_buffer_sax(std::string_view buffer, MemSpec::MemSpecVariant& result, std::string_view key)
+{
+    return util::sax::parse(buffer.data(), buffer.data() + buffer.size(), result, key);
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_buffer_sax(std::string_view buffer, std::string_view key)
+{
+    MemSpec::MemSpecVariant result;
+    if (parse_memspec_from_buffer_sax(buffer, result, key) == util::ParseStatus::Ok)
+        return result;
+
+    return std::nullopt;
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file_sax(const std::filesystem::path &path, std::string_view key)
+{
+    try
+    {
+        const util::MappedFile file(path);
+        if (!file.isOpen())
+            return std::nullopt;
+
+        return parse_memspec_from_buffer_sax(file.view(), key);
+    }
+    catch (std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+DRAMUTILS_INLINE MemSpecResult parse_memspec_from_json_checked(const json_t& json, std::string_view key)
+{
+    MemSpec::MemSpecVariant result;
+    util::ParseError error;
+    if (detail::parse_memspec_from_json(json, result, key, &error) == util::ParseStatus::Ok)
+        return result;
+    return util::unexpected(std::move(error));
+}
+
+DRAMUTILS_INLINE MemSpecResult parse_memspec_from_buffer_checked(std::string_view buffer, std::string_view key)
+{
+    MemSpec::MemSpecVariant result;
+    util::ParseError error;
+    if (util::sax::parse(buffer.data(), buffer.data() + buffer.size(), result, key, json_t::input_format_t::json, &error) == util::ParseStatus::Ok)
+        return result;
+    return util::unexpected(std::move(error));
+}
+
+DRAMUTILS_INLINE MemSpecResult parse_memspec_from_file_checked(const std::filesystem::path &path, std::string_view key)
+{
+    const util::MappedFile file(path);
+    if (!file.isOpen())
+    {
+        util::ParseError error;
+        error.status = util::ParseStatus::FileError;
+        return util::unexpected(std::move(error));
+    }
+    return parse_memspec_from_buffer_checked(file.view(), key);
+}
+
+DRAMUTILS_INLINE std::vector<MemSpecFileResult> parse_memspecs_from_directory(const std::filesystem::path &directory, std::size_t threads, std::string_view key)
+{
+    std::vector<MemSpecFileResult> results;
+
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (it->path().extension() == ".json" && it->is_regular_file(ec))
+        {
+            MemSpecFileResult result;
+            result.path = it->path();
+            results.push_back(std::move(result));
+        }
+    }
+    if (ec)
+        return {};
+    std::sort(results.begin(), results.end(), [](const auto& lhs, const auto& rhs) { return lhs.path < rhs.path; });
+
+    // Every worker takes the next unparsed file, so each result is written by a single thread
+    std::atomic<std::size_t> next{0};
+    const auto worker = [&results, &next, key]() {
+        for (std::size_t i = next++; i < results.size(); i = next++)
+        {
+            auto& result = results[i];
+            try
+            {
+                auto parsed = parse_memspec_from_file_checked(result.path, key);
+                if (parsed)
+                {
+                    result.status = util::ParseStatus::Ok;
+                    result.memspec = std::move(*parsed);
+                }
+                else
+                {
+                    result.status = parsed.error().status;
+                    result.error = std::move(parsed.error());
+                }
+            }
+            catch (std::exception&)
+            {
+                result.status = util::ParseStatus::FileError;
+                result.error = util::ParseError{};
+                result.error.status = util::ParseStatus::FileError;
+            }
+        }
+    };
+
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, results.size());
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    try
+    {
+        // The calling thread is the last worker
+        for (std::size_t i = 1; i < threads; ++i)
+            pool.emplace_back(worker);
+    }
+    catch (std::system_error&)
+    {
+        // Continue with the threads started so far
+    }
+    worker();
+    for (auto& thread : pool)
+        thread.join();
+
+    return results;
+}
+
+DRAMUTILS_INLINE util::ParseStatus parse_memspec_from_binary(const std::vector<std::uint8_t>& buffer, MemSpec::MemSpecVariant& result, BinaryFormat format, std::string_view key)
+{
+    return util::sax::parse(buffer.data(), buffer.data() + buffer.size(), result, key, detail::input_format(format));
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_cbor(const std::vector<std::uint8_t>& buffer, std::string_view key)
+{
+    MemSpec::MemSpecVariant result;
+    if (parse_memspec_from_binary(buffer, result, BinaryFormat::CBOR, key) == util::ParseStatus::Ok)
+        return result;
+
+    return std::nullopt;
+}
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_msgpack(const std::vector<std::uint8_t>& buffer, std::string_view key)
+{
+    MemSpec::MemSpecVariant result;
+    if (parse_memspec_from_binary(buffer, result, BinaryFormat::MessagePack, key) == util::ParseStatus::Ok)
+        return result;
+
+    return std::nullopt;
+}
+
+DRAMUTILS_INLINE std::vector<std::uint8_t> write_memspec_to_binary(const MemSpec::MemSpecVariant& memspec, BinaryFormat format, std::string_view key)
+{
+    json_t json;
+    if (key.empty())
+        memspec.to_json(json);
+    else
+        memspec.to_json(json[std::string(key)]);
+
+    return format == BinaryFormat::CBOR ? json_t::to_cbor(json) : json_t::to_msgpack(json);
+}
+
+DRAMUTILS_INLINE std::vector<std::uint8_t> write_memspec_to_cbor(const MemSpec::MemSpecVariant& memspec, std::string_view key)
+{
+    return write_memspec_to_binary(memspec, BinaryFormat::CBOR, key);
+}
+
+DRAMUTILS_INLINE std::vector<std::uint8_t> write_memspec_to_msgpack(const MemSpec::MemSpecVariant& memspec, std::string_view key)
+{
+    return write_memspec_to_binary(memspec, BinaryFormat::MessagePack, key);
+}
+
+namespace detail
+{
+
+template <typename Sink>
+void write_memspec_to_json(Sink& sink, const MemSpec::MemSpecVariant& memspec, int indent, std::string_view key)
+{
+    util::JsonWriter<Sink> writer(sink, indent);
+    if (key.empty())
+        writer.write(memspec);
+    else
+        writer.writeObject(key, memspec);
+}
+
+} // namespace detail
+
+DRAMUTILS_INLINE void write_memspec_to_json(std::string& out, const MemSpec::MemSpecVariant& memspec, int indent, std::string_view key)
+{
+    util::StringSink sink{out};
+    detail::write_memspec_to_json(sink, memspec, indent, key);
+}
+
+DRAMUTILS_INLINE void write_memspec_to_json(std::ostream& out, const MemSpec::MemSpecVariant& memspec, int indent, std::string_view key)
+{
+    util::StreamSink sink{out};
+    detail::write_memspec_to_json(sink, memspec, indent, key);
+}
+
+DRAMUTILS_INLINE std::size_t write_memspec_to_json(char* buffer, std::size_t size, const MemSpec::MemSpecVariant& memspec, int indent, std::string_view key)
+{
+    util::BufferSink sink{buffer, size};
+    detail::write_memspec_to_json(sink, memspec, indent, key);
+    return sink.length;
+}
+
+namespace detail
+{
+
+// Header of a binary MemSpec cache file, followed by the encoded MemSpec
+struct CacheHeader
+{
+    std::array<char, 8> magic{'D', 'U', 'M', 'S', 'C', 'A', 'C', 'H'};
+    std::uint32_t version = 1;
+    std::uint32_t format = 0;
+    std::int64_t sourceTime = 0;
+    std::uint64_t sourceSize = 0;
+    std::uint64_t sourceHash = 0;
+};
+
+inline bool operator==(const CacheHeader& lhs, const CacheHeader& rhs)
+{
+    return lhs.magic == rhs.magic && lhs.version == rhs.version && lhs.format == rhs.format &&
+           lhs.sourceTime == rhs.sourceTime && lhs.sourceSize == rhs.sourceSize &&
+           lhs.sourceHash == rhs.sourceHash;
+}
+
+inline std::filesystem::path cache_path(const std::filesystem::path& path, BinaryFormat format)
+{
+    std::filesystem::path result = path;
+    result += format == BinaryFormat::CBOR ? ".cbor" : ".msgpack";
+    return result;
+}
+
+// Writes the cache to a temporary file first, so concurrent readers never see partial files
+inline void write_cache(const std::filesystem::path& path, const CacheHeader& header, const std::vector<std::uint8_t>& payload)
+{
+    try
+    {
+        std::filesystem::path temp = path;
+        temp += ".tmp" + std::to_string(std::random_device{}());
+
+        std::ofstream file(temp, std::ios::binary);
+        if (!file.is_open())
+            return;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        file.close();
+
+        std::error_code ec;
+        if (file.fail())
+            std::filesystem::remove(temp, ec);
+        else
+            std::filesystem::rename(temp, path, ec);
+        if (ec)
+            std::filesystem::remove(temp, ec);
+    }
+    catch (std::exception&)
+    {
+        // The cache is optional
+    }
+}
+
+} // namespace detail
+
+DRAMUTILS_INLINE std::optional<MemSpec::MemSpecVariant> parse_memspec_from_file_cached(const std::filesystem::path &path, std::string_view key, BinaryFormat format)
+{
+    try
+    {
+        std::error_code ec;
+        const auto time = std::filesystem::last_write_time(path, ec);
+        if (ec)
+            return std::nullopt;
+
+        const util::MappedFile source_file(path);
+        if (!source_file.isOpen())
+            return std::nullopt;
+        const std::string_view source = source_file.view();
+
+        detail::CacheHeader header;
+        header.format = static_cast<std::uint32_t>(format);
+        header.sourceTime = static_cast<std::int64_t>(time.time_since_epoch().count());
+        header.sourceSize = source.size();
+        header.sourceHash = util::fnv1a(key, util::fnv1a(source));
+
+        // Reuse the cache if it was created from the same source
+        const auto cache_file = detail::cache_path(path, format);
+        if (const util::MappedFile cache_file_view(cache_file); cache_file_view.view().size() > sizeof(header))
+        {
+            const std::string_view cache = cache_file_view.view();
+            detail::CacheHeader cache_header;
+            std::memcpy(&cache_header, cache.data(), sizeof(cache_header));
+
+            const auto* payload = reinterpret_cast<const std::uint8_t*>(cache.data());
+            MemSpec::MemSpecVariant result;
+            if (cache_header == header &&
+                util::sax::parse(payload + sizeof(header), payload + cache.size(), result, {}, detail::input_format(format)) == util::ParseStatus::Ok)
+                return result;
+        }
+
+        auto result = parse_memspec_from_buffer_sax(source, key);
+        if (result)
+            detail::write_cache(cache_file, header, write_memspec_to_binary(*result, format, {}));
+        return result;
+    }
+    catch (std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+} // namespace DRAMUtils
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECIMPL_H */
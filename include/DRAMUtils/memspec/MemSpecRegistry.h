@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECREGISTRY_H
+#define DRAMUTILS_MEMSPEC_MEMSPECREGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/util/atomic_shared_ptr.h"
+#include "DRAMUtils/util/expected.h"
+#include "DRAMUtils/util/parse_status.h"
+
+namespace DRAMUtils::MemSpec
+{
+
+/**
+ * @brief Process-wide store of immutable MemSpecs shared by all their users.
+ *        MemSpecs are interned by content, so equal MemSpecs loaded from different files or
+ *        created in code share one object. Loaded files are additionally indexed by path and key.
+ * 
+ *        Readers never take the writer lock: the indices are an immutable snapshot which is
+ *        replaced as a whole (copy on write) and read through util::AtomicSharedPtr, which is
+ *        not necessarily lock free. Writers are serialized by a mutex and copy the indices
+ *        once per call, so many files should be added with the batch overloads.
+ *        Handles stay valid after clear().
+ */
+class MemSpecRegistry
+{
+public:
+    using Handle = std::shared_ptr<const MemSpecVariant>;
+    using LoadResult = util::Expected<Handle, util::ParseError>;
+
+    // The registry of the process
+    DRAMUTILS_INLINE static MemSpecRegistry& instance();
+
+    MemSpecRegistry() = default;
+    MemSpecRegistry(const MemSpecRegistry&) = delete;
+    MemSpecRegistry& operator=(const MemSpecRegistry&) = delete;
+
+    /**
+     * @brief Returns the MemSpec of the file. The file is only parsed on the first request
+     *        for the path and key, later requests share the same object.
+     * 
+     * @return The shared MemSpec or the cause of the failure, see parse_memspec_from_file_checked.
+     */
+    DRAMUTILS_INLINE LoadResult load(const std::filesystem::path& path, std::string_view key = DRAMUtils::detail::keys::memSpec);
+
+    // Loads all files like load(path, key) and publishes the new entries at once
+    DRAMUTILS_INLINE std::vector<LoadResult> load(const std::vector<std::filesystem::path>& paths, std::string_view key = DRAMUtils::detail::keys::memSpec);
+
+    // Returns the shared object with the content of memspec, memspec is added if it is new
+    DRAMUTILS_INLINE Handle intern(MemSpecVariant memspec);
+
+    // Interns all memspecs like intern(memspec) and publishes the new entries at once
+    DRAMUTILS_INLINE std::vector<Handle> intern(std::vector<MemSpecVariant> memspecs);
+
+    /**
+     * @brief Lookup of a loaded file without the writer lock, nullptr if the file was not loaded.
+     *        The path is only canonicalized, which accesses the file system, if it differs from
+     *        the spelling that was passed to load.
+     */
+    DRAMUTILS_INLINE Handle find(const std::filesystem::path& path, std::string_view key = DRAMUtils::detail::keys::memSpec) const;
+
+    // Number of distinct MemSpecs
+    DRAMUTILS_INLINE std::size_t size() const;
+
+    // Removes all entries, handed out handles stay valid
+    DRAMUTILS_INLINE void clear();
+
+    // Content hash of a MemSpec, equal MemSpecs (operator==) have equal hashes
+    DRAMUTILS_INLINE static std::uint64_t contentHash(const MemSpecVariant& memspec);
+
+private:
+    struct Snapshot
+    {
+        std::unordered_map<std::string, Handle> byPath;
+        std::unordered_map<std::uint64_t, std::vector<Handle>> byContent;
+        std::size_t size = 0;
+    };
+
+    std::shared_ptr<const Snapshot> snapshot() const { return current.load(); }
+
+    // Requires the writer lock
+    Handle internLocked(MemSpecVariant memspec, Snapshot& next);
+
+    // Key of the path as spelled by the caller, without file system access
+    static std::string spellingKey(const std::filesystem::path& path, std::string_view key);
+
+    // Key of the canonical path, different spellings of the same file share it
+    static std::string pathKey(const std::filesystem::path& path, std::string_view key);
+
+    util::AtomicSharedPtr<const Snapshot> current{std::make_shared<const Snapshot>()};
+    std::mutex writer;
+};
+
+} // namespace DRAMUtils::MemSpec
+
+#ifndef DRAMUTILS_COMPILED
+#include "MemSpecRegistryImpl.h"
+#endif
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECREGISTRY_H */
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECREGISTRYIMPL_H
+#define DRAMUTILS_MEMSPEC_MEMSPECREGISTRYIMPL_H
+
+// Definitions of the functions declared in MemSpecRegistry.h. Included by MemSpecRegistry.h in
+// header-only mode and compiled into the library in DRAMUTILS_COMPILED mode.
+
+#include <system_error>
+#include <utility>
+
+#include "DRAMUtils/util/content_hash.h"
+#include "DRAMUtils/memspec/MemSpecRegistry.h"
+
+namespace DRAMUtils::MemSpec {
+
+DRAMUTILS_INLINE MemSpecRegistry& MemSpecRegistry::instance()
+{
+    static MemSpecRegistry registry;
+    return registry;
+}
+
+DRAMUTILS_INLINE MemSpecRegistry::LoadResult MemSpecRegistry::load(const std::filesystem::path& path, std::string_view key)
+{
+    auto results = load(std::vector<std::filesystem::path>{path}, key);
+    return std::move(results.front());
+}
+
+DRAMUTILS_INLINE std::vector<MemSpecRegistry::LoadResult> MemSpecRegistry::load(const std::vector<std::filesystem::path>& paths, std::string_view key)
+{
+    struct Parsed
+    {
+        std::size_t index;
+        std::string spelling;
+        std::string canonical;
+        MemSpecVariant memspec;
+    };
+
+    std::vector<LoadResult> results;
+    results.reserve(paths.size());
+    std::vector<Parsed> parsed;
+    const auto snap = snapshot();
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        std::string spelling = spellingKey(paths[i], key);
+        if (const auto it = snap->byPath.find(spelling); it != snap->byPath.end())
+        {
+            results.emplace_back(it->second);
+            continue;
+        }
+        std::string canonical = pathKey(paths[i], key);
+        if (const auto it = snap->byPath.find(canonical); it != snap->byPath.end())
+        {
+            results.emplace_back(it->second);
+            continue;
+        }
+
+        // Parse outside of the lock, concurrent loads of the same file intern the same object
+        auto memspec = parse_memspec_from_file_checked(paths[i], key);
+        if (!memspec)
+        {
+            results.emplace_back(util::unexpected(std::move(memspec.error())));
+            continue;
+        }
+        results.emplace_back(Handle{});
+        parsed.push_back(Parsed{i, std::move(spelling), std::move(canonical), std::move(*memspec)});
+    }
+    if (parsed.empty())
+        return results;
+
+    std::lock_guard<std::mutex> lock(writer);
+    auto next = std::make_shared<Snapshot>(*current.load());
+    for (auto& entry : parsed)
+    {
+        Handle handle;
+        if (const auto it = next->byPath.find(entry.canonical); it != next->byPath.end())
+            handle = it->second;
+        else
+            handle = internLocked(std::move(entry.memspec), *next);
+
+        // Both spellings are indexed, so find only canonicalizes unknown spellings
+        next->byPath.emplace(std::move(entry.canonical), handle);
+        next->byPath.emplace(std::move(entry.spelling), handle);
+        results[entry.index] = handle;
+    }
+    current.store(std::move(next));
+    return results;
+}
+
+DRAMUTILS_INLINE MemSpecRegistry::Handle MemSpecRegistry::intern(MemSpecVariant memspec)
+{
+    std::vector<MemSpecVariant> memspecs;
+    memspecs.push_back(std::move(memspec));
+    return intern(std::move(memspecs)).front();
+}
+
+DRAMUTILS_INLINE std::vector<MemSpecRegistry::Handle> MemSpecRegistry::intern(std::vector<MemSpecVariant> memspecs)
+{
+    std::vector<Handle> handles;
+    handles.reserve(memspecs.size());
+
+    std::lock_guard<std::mutex> lock(writer);
+    auto next = std::make_shared<Snapshot>(*current.load());
+    const std::size_t size = next->size;
+    for (auto& memspec : memspecs)
+        handles.push_back(internLocked(std::move(memspec), *next));
+    if (next->size != size)
+        current.store(std::move(next));
+    return handles;
+}
+
+DRAMUTILS_INLINE MemSpecRegistry::Handle MemSpecRegistry::find(const std::filesystem::path& path, std::string_view key) const
+{
+    const auto snap = snapshot();
+    if (const auto it = snap->byPath.find(spellingKey(path, key)); it != snap->byPath.end())
+        return it->second;
+    const auto it = snap->byPath.find(pathKey(path, key));
+    return it != snap->byPath.end() ? it->second : nullptr;
+}
+
+DRAMUTILS_INLINE std::size_t MemSpecRegistry::size() const
+{
+    return snapshot()->size;
+}
+
+DRAMUTILS_INLINE void MemSpecRegistry::clear()
+{
+    std::lock_guard<std::mutex> lock(writer);
+    current.store(std::make_shared<const Snapshot>());
+}
+
+DRAMUTILS_INLINE std::uint64_t MemSpecRegistry::contentHash(const MemSpecVariant& memspec)
+{
+    return util::content_hash(memspec);
+}
+
+DRAMUTILS_INLINE MemSpecRegistry::Handle MemSpecRegistry::internLocked(MemSpecVariant memspec, Snapshot& next)
+{
+    auto& candidates = next.byContent[contentHash(memspec)];
+    for (const auto& candidate : candidates)
+    {
+        // Equal hashes are confirmed by comparing the fields
+        if (*candidate == memspec)
+            return candidate;
+    }
+
+    candidates.push_back(std::make_shared<const MemSpecVariant>(std::move(memspec)));
+    ++next.size;
+    return candidates.back();
+}
+
+DRAMUTILS_INLINE std::string MemSpecRegistry::spellingKey(const std::filesystem::path& path, std::string_view key)
+{
+    std::string name = path.string();
+    name.push_back('\0');
+    name.append(key);
+    return name;
+}
+
+DRAMUTILS_INLINE std::string MemSpecRegistry::pathKey(const std::filesystem::path& path, std::string_view key)
+{
+    // Different spellings of the same file share an entry
+    std::error_code ec;
+    auto canonical = std::filesystem::weakly_canonical(path, ec);
+    return spellingKey(ec ? path : canonical, key);
+}
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECREGISTRYIMPL_H */
@@ -0,0 +1,456 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECSNAPSHOT_H
+#define DRAMUTILS_MEMSPEC_MEMSPECSNAPSHOT_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/util/content_hash.h"
+#include "DRAMUtils/util/expected.h"
+#include "DRAMUtils/util/mapped_file.h"
+#include "DRAMUtils/util/parse_status.h"
+
+namespace DRAMUtils::MemSpec
+{
+
+/**
+ * @brief Header of a binary MemSpec snapshot. It is followed by the bytes of the standard
+ *        struct (e.g. MemSpecDDR5) at payloadOffset. The standards are trivially copyable and
+ *        hold no pointers, so the payload is position independent and used in place.
+ *        The schema hash covers the names, types, sizes and offsets of all fields, a snapshot
+ *        is only accepted by builds with the same layout of the standard.
+ */
+struct SnapshotHeader
+{
+    static constexpr std::uint32_t currentVersion = 1;
+    static constexpr std::uint32_t nativeByteOrder = 0x01020304;
+
+    std::array<char, 8> magic{'D', 'U', 'M', 'S', 'S', 'N', 'A', 'P'};
+    std::uint32_t version = currentVersion;
+    std::uint32_t byteOrder = nativeByteOrder;
+    std::uint64_t schemaHash = 0;
+    std::uint64_t payloadOffset = 0;
+    std::uint64_t payloadSize = 0;
+    std::array<char, 24> standard{}; // Id of the standard, zero padded
+};
+static_assert(sizeof(SnapshotHeader) == 64 && std::is_trivially_copyable_v<SnapshotHeader>);
+
+namespace detail
+{
+
+// The payload starts at a cache line boundary, which satisfies the alignment of all standards
+constexpr std::size_t snapshot_payload_offset = 64;
+
+template <typename T>
+void describe_layout(util::ContentHasher& hasher, std::size_t offset)
+{
+    hasher.word(offset);
+    hasher.word(sizeof(T));
+    hasher.word(alignof(T));
+    if constexpr (util::is_optional<T>)
+    {
+        using Value = typename T::value_type;
+        static const T probe{Value{}};
+        hasher.word('o');
+        describe_layout<Value>(hasher, static_cast<std::size_t>(
+            reinterpret_cast<const char*>(&*probe) - reinterpret_cast<const char*>(&probe)));
+    }
+    else if constexpr (util::has_json_fields<T>::value)
+    {
+        static const T probe{};
+        hasher.word('{');
+        util::for_each_field(probe, [&hasher](std::string_view name, const auto& field) {
+            hasher.bytes(name);
+            describe_layout<std::decay_t<decltype(field)>>(hasher, static_cast<std::size_t>(
+                reinterpret_cast<const char*>(&field) - reinterpret_cast<const char*>(&probe)));
+        });
+        hasher.word('}');
+    }
+    else if constexpr (util::is_fixed_string<T>)
+    {
+        hasher.word('s');
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        hasher.word('e');
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        hasher.word('b');
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        hasher.word('f');
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        hasher.word(std::is_signed_v<T> ? 'i' : 'u');
+    }
+    else
+    {
+        static_assert(util::always_false<T>::value, "Type cannot be stored in a snapshot.");
+    }
+}
+
+// Offset of the engaged flag of std::optional<Value>, the only byte that differs between an
+// empty and an engaged optional holding the zero value
+template <typename T>
+std::size_t optional_flag_offset()
+{
+    static const T empty{};
+    static const T engaged{typename T::value_type{}};
+    const auto* lhs = reinterpret_cast<const unsigned char*>(&empty);
+    const auto* rhs = reinterpret_cast<const unsigned char*>(&engaged);
+    return static_cast<std::size_t>(std::mismatch(lhs, lhs + sizeof(T), rhs).first - lhs);
+}
+
+/**
+ * @brief Checks the bytes of a T at data that are not valid for every bit pattern, without
+ *        reading them as T: bools and engaged flags must be 0 or 1, enums values of their
+ *        serializer table and fixed strings within their capacity.
+ *        On failure path is set to the JSON pointer of the invalid field.
+ */
+template <typename T>
+bool validate_payload(const char* data, std::string& path)
+{
+    if constexpr (util::is_optional<T>)
+    {
+        using Value = typename T::value_type;
+        static const std::size_t flag = optional_flag_offset<T>();
+        static const T probe{Value{}};
+        const auto offset = static_cast<std::size_t>(
+            reinterpret_cast<const char*>(&*probe) - reinterpret_cast<const char*>(&probe));
+        unsigned char engaged = 0;
+        std::memcpy(&engaged, data + flag, 1);
+        if (engaged > 1)
+            return false;
+        return engaged == 0 || validate_payload<Value>(data + offset, path);
+    }
+    else if constexpr (util::has_json_fields<T>::value)
+    {
+        static const T probe{};
+        bool valid = true;
+        util::for_each_field(probe, [&](auto name, const auto& field) {
+            if (!valid)
+                return;
+            const auto offset = static_cast<std::size_t>(
+                reinterpret_cast<const char*>(&field) - reinterpret_cast<const char*>(&probe));
+            valid = validate_payload<std::decay_t<decltype(field)>>(data + offset, path);
+            if (!valid)
+                path.insert(0, "/" + std::string(name.value));
+        });
+        return valid;
+    }
+    else if constexpr (util::is_fixed_string<T>)
+    {
+        T value;
+        std::memcpy(static_cast<void*>(&value), data, sizeof(T));
+        return value.size() <= T::capacity && value.data()[T::capacity] == '\0';
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        unsigned char value = 0;
+        std::memcpy(&value, data, 1);
+        return value <= 1;
+    }
+    else if constexpr (util::has_json_enum_text<T>::value)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return !json_enum_text(value).empty();
+    }
+    else
+    {
+        // Every bit pattern of integers, floating point numbers and other enums is a value
+        return true;
+    }
+}
+
+template <typename T>
+constexpr bool is_snapshot_type = std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T> &&
+                                  alignof(T) <= snapshot_payload_offset;
+
+} // namespace detail
+
+// Hash of the memory layout of the standard T, computed once per process
+template <typename T>
+std::uint64_t snapshot_schema_hash()
+{
+    static_assert(detail::is_snapshot_type<T>, "The standard is not trivially copyable.");
+    static const std::uint64_t hash = [] {
+        util::ContentHasher hasher;
+        hasher.bytes(T::id);
+        detail::describe_layout<T>(hasher, 0);
+        return hasher.digest();
+    }();
+    return hash;
+}
+
+// Snapshot bytes of memspec: the header followed by the standard struct
+inline std::vector<char> make_memspec_snapshot(const MemSpecVariant& memspec)
+{
+    std::vector<char> buffer;
+    std::visit([&buffer](const auto& standard) {
+        using T = std::decay_t<decltype(standard)>;
+        static_assert(T::id.size() < std::tuple_size_v<decltype(SnapshotHeader::standard)>);
+
+        SnapshotHeader header;
+        header.schemaHash = snapshot_schema_hash<T>();
+        header.payloadOffset = detail::snapshot_payload_offset;
+        header.payloadSize = sizeof(T);
+        std::memcpy(header.standard.data(), T::id.data(), T::id.size());
+
+        buffer.assign(detail::snapshot_payload_offset + sizeof(T), '\0');
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        std::memcpy(buffer.data() + detail::snapshot_payload_offset, &standard, sizeof(T));
+    }, memspec.getVariant());
+    return buffer;
+}
+
+/**
+ * @brief Writes the snapshot of memspec to path. The file is written to a temporary file
+ *        first and renamed, so concurrent readers never see partial snapshots.
+ * 
+ * @return false if the file could not be written.
+ */
+inline bool write_memspec_snapshot(const std::filesystem::path& path, const MemSpecVariant& memspec)
+{
+    try
+    {
+        const std::vector<char> buffer = make_memspec_snapshot(memspec);
+        std::filesystem::path temp = path;
+        temp += ".tmp" + std::to_string(std::random_device{}());
+
+        std::ofstream file(temp, std::ios::binary);
+        if (!file.is_open())
+            return false;
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        file.close();
+
+        std::error_code ec;
+        if (!file.fail())
+            std::filesystem::rename(temp, path, ec);
+        if (file.fail() || ec)
+        {
+            std::filesystem::remove(temp, ec);
+            return false;
+        }
+        return true;
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+}
+
+/**
+ * @brief Memory mapped MemSpec snapshot. Opening validates the header and the bytes of the
+ *        fields that are not valid for every bit pattern (bools, enums, optionals and strings),
+ *        afterwards the standard is accessed in place without parsing or copying. The snapshot
+ *        must outlive the references handed out by get() and visit().
+ */
+class MemSpecSnapshot
+{
+public:
+    using OpenResult = util::Expected<MemSpecSnapshot, util::ParseError>;
+
+    /**
+     * @brief Maps the snapshot file and validates its header.
+     * 
+     * @return The snapshot or the cause of the failure: ParseStatus::FileError if the file
+     *         could not be read, ParseStatus::UnknownId for unknown standards and
+     *         ParseStatus::InvalidValue for a bad header, a schema of a different build or an
+     *         invalid field value, whose JSON pointer is reported as path.
+     */
+    static OpenResult open(const std::filesystem::path& path)
+    {
+        MemSpecSnapshot snapshot;
+        snapshot.file = util::MappedFile(path);
+        if (!snapshot.file.isOpen())
+            return util::unexpected(error(util::ParseStatus::FileError, "readable file"));
+
+        const std::string_view data = snapshot.file.view();
+        SnapshotHeader header;
+        if (data.size() < sizeof(header))
+            return util::unexpected(error(util::ParseStatus::InvalidValue, "snapshot header"));
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        const SnapshotHeader reference;
+        if (header.magic != reference.magic)
+            return util::unexpected(error(util::ParseStatus::InvalidValue, "snapshot header"));
+        if (header.version != reference.version || header.byteOrder != reference.byteOrder)
+            return util::unexpected(error(util::ParseStatus::InvalidValue, "snapshot version " +
+                std::to_string(SnapshotHeader::currentVersion) + " in native byte order"));
+
+        const auto end = std::find(header.standard.begin(), header.standard.end(), '\0');
+        const std::string_view standard(header.standard.data(),
+            static_cast<std::size_t>(end - header.standard.begin()));
+        const auto index = MemSpecVariant::findIndex(standard);
+        if (!index)
+            return util::unexpected(error(util::ParseStatus::UnknownId, "known standard", std::string(standard)));
+
+        util::ParseError layout = error(util::ParseStatus::InvalidValue, "", std::string(standard));
+        const bool valid = dispatch(*index, [&](auto* tag) {
+            using T = std::remove_pointer_t<decltype(tag)>;
+            if (header.schemaHash != snapshot_schema_hash<T>())
+                layout.expected = "schema of this build";
+            else if (header.payloadSize != sizeof(T) || header.payloadOffset % alignof(T) != 0 ||
+                     header.payloadOffset > data.size() || data.size() - header.payloadOffset < sizeof(T))
+                layout.expected = "complete payload";
+            else if (reinterpret_cast<std::uintptr_t>(data.data() + header.payloadOffset) % alignof(T) != 0)
+                layout.expected = "aligned payload";
+            else if (!detail::validate_payload<T>(data.data() + header.payloadOffset, layout.path))
+                layout.expected = "valid field value";
+            return layout.expected.empty();
+        });
+        if (!valid)
+            return util::unexpected(std::move(layout));
+
+        snapshot.index = *index;
+        snapshot.payloadOffset = static_cast<std::size_t>(header.payloadOffset);
+        return snapshot;
+    }
+
+    MemSpecSnapshot(MemSpecSnapshot&&) noexcept = default;
+    MemSpecSnapshot& operator=(MemSpecSnapshot&&) noexcept = default;
+
+    // Id of the standard, e.g. "DDR5"
+    std::string_view standard() const
+    {
+        std::string_view id;
+        dispatch(index, [&id](auto* tag) {
+            id = std::remove_pointer_t<decltype(tag)>::id;
+            return true;
+        });
+        return id;
+    }
+
+    // The mapped standard or nullptr if the snapshot holds a different standard
+    template <typename T>
+    const T* get() const noexcept
+    {
+        static_assert(util::is_one_of<T, VariantTypes>::value, "Invalid Variant type!");
+        if (index != type_index<T>(VariantTypes{}))
+            return nullptr;
+        return std::launder(reinterpret_cast<const T*>(file.view().data() + payloadOffset));
+    }
+
+    // Calls f with the mapped standard and returns its result
+    template <typename F>
+    decltype(auto) visit(F&& f) const
+    {
+        return visit(f, VariantTypes{});
+    }
+
+    // Copy of the mapped standard, no parsing is involved
+    MemSpecVariant memspec() const
+    {
+        MemSpecVariant result;
+        visit([&result](const auto& standard) { result.setVariant(standard); });
+        return result;
+    }
+
+private:
+    MemSpecSnapshot() = default;
+
+    static util::ParseError error(util::ParseStatus status, std::string expected, std::string standard = {})
+    {
+        util::ParseError result;
+        result.status = status;
+        result.expected = std::move(expected);
+        result.standard = std::move(standard);
+        return result;
+    }
+
+    // Calls f with a null pointer of the standard with the given index
+    template <typename F>
+    static bool dispatch(std::size_t index, F&& f)
+    {
+        return dispatch(index, f, VariantTypes{});
+    }
+
+    template <typename F, typename... Ts>
+    static bool dispatch(std::size_t index, F& f, util::type_sequence<Ts...>)
+    {
+        std::size_t i = 0;
+        return ((index == i++ && f(static_cast<Ts*>(nullptr))) || ...);
+    }
+
+    template <typename T, typename... Ts>
+    static constexpr std::size_t type_index(util::type_sequence<Ts...>) noexcept
+    {
+        std::size_t i = 0;
+        ((std::is_same_v<T, Ts> ? false : (++i, true)) && ...);
+        return i;
+    }
+
+    template <typename F, typename T, typename... Ts>
+    std::invoke_result_t<F&, const T&> visit(F& f, util::type_sequence<T, Ts...>) const
+    {
+        if constexpr (sizeof...(Ts) != 0)
+        {
+            if (index != type_index<T>(VariantTypes{}))
+                return visit(f, util::type_sequence<Ts...>{});
+        }
+        return f(*get<T>());
+    }
+
+    util::MappedFile file;
+    std::size_t index = 0;
+    std::size_t payloadOffset = 0;
+};
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECSNAPSHOT_H */
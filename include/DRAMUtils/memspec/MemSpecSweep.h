@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECSWEEP_H
+#define DRAMUTILS_MEMSPEC_MEMSPECSWEEP_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/util/json_utils.h"
+
+namespace DRAMUtils::MemSpec
+{
+
+namespace detail
+{
+
+// Numeric field reachable by a field path, e.g. "memtimingspec.RCD"
+template <typename T>
+struct SweepTarget
+{
+    std::function<void(T&, double)> set;
+    bool integral = false;
+    double lowest = 0.0;
+    double limit = 0.0; // Exclusive upper bound, max + 1 of integer fields is exact as double
+
+    explicit operator bool() const noexcept { return static_cast<bool>(set); }
+};
+
+template <typename T>
+SweepTarget<T> sweep_target(std::string_view path);
+
+template <typename T, typename Field>
+SweepTarget<T> sweep_member_target(Field T::* member, std::string_view path)
+{
+    SweepTarget<Field> inner = sweep_target<Field>(path);
+    if (!inner)
+        return {};
+    return {[member, set = std::move(inner.set)](T& obj, double value) { set(obj.*member, value); },
+            inner.integral, inner.lowest, inner.limit};
+}
+
+template <typename T, std::size_t... Is>
+SweepTarget<T> sweep_member_target(std::size_t index, std::string_view path, std::index_sequence<Is...>)
+{
+    constexpr auto members = json_field_pointers(util::field_tag<T>{});
+    SweepTarget<T> result;
+    ((index == Is && (result = sweep_member_target<T>(std::get<Is>(members), path), true)) || ...);
+    return result;
+}
+
+// Resolves path below T, the result is empty if path does not name a numeric field.
+// Leaf fields are reached with an empty remaining path.
+// Absent optional structs on the path are value initialized when the field is set.
+template <typename T>
+SweepTarget<T> sweep_target(std::string_view path)
+{
+    if constexpr (util::is_optional<T>)
+    {
+        using Value = typename T::value_type;
+        SweepTarget<Value> inner = sweep_target<Value>(path);
+        if (!inner)
+            return {};
+        return {[set = std::move(inner.set)](T& field, double value) {
+                    if (!field)
+                        field.emplace();
+                    set(*field, value);
+                },
+                inner.integral, inner.lowest, inner.limit};
+    }
+    else if constexpr (util::has_json_fields<T>::value)
+    {
+        const std::size_t dot = path.find('.');
+        const auto index = util::field_index<T>(path.substr(0, dot));
+        if (path.empty() || !index)
+            return {};
+        const std::string_view rest = dot == std::string_view::npos ? std::string_view{} : path.substr(dot + 1);
+        return sweep_member_target<T>(*index, rest, std::make_index_sequence<util::field_count<T>>{});
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (!path.empty())
+            return {};
+        double limit = std::numeric_limits<double>::infinity();
+        if constexpr (std::is_integral_v<T>)
+            limit = std::ldexp(1.0, std::numeric_limits<T>::digits);
+        return {[](T& field, double value) { field = static_cast<T>(value); }, std::is_integral_v<T>,
+                static_cast<double>(std::numeric_limits<T>::lowest()), limit};
+    }
+    else
+    {
+        return {};
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Design space exploration over a base MemSpec. Every range names a numeric field by
+ *        its path below the standard, e.g. "memtimingspec.RCD", "memarchitecturespec.nbrOfBanks"
+ *        or "mempowerspec.idd4r", and lists the values it takes.
+ *        The cartesian product is iterated lazily. The iterator keeps one working copy of the
+ *        base and only rewrites the fields whose value changes between two points; nothing is
+ *        serialized, parsed or written to disk. Points can also be materialized individually,
+ *        e.g. for a Latin hypercube sample of the product.
+ */
+class MemSpecSweep
+{
+public:
+    struct Range
+    {
+        std::string field;
+        std::vector<double> values;
+
+        // first, first + step, ... up to and including last
+        static Range linear(std::string field, double first, double last, double step)
+        {
+            if (!(step > 0.0) || last < first)
+                throw std::invalid_argument("MemSpecSweep: invalid linear range of " + field);
+            Range range{std::move(field), {}};
+            const auto count = static_cast<std::size_t>(std::floor((last - first) / step + 1e-9)) + 1;
+            range.values.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+                range.values.push_back(first + static_cast<double>(i) * step);
+            return range;
+        }
+    };
+
+    // Value index per range
+    using Point = std::vector<std::size_t>;
+
+    /**
+     * @brief Resolves the field paths of ranges for the standard of base.
+     * 
+     * @throws std::invalid_argument if a path does not name a numeric field of the standard,
+     *         a range is empty or a value does not fit into its integer field.
+     */
+    MemSpecSweep(MemSpecVariant base, std::vector<Range> ranges)
+        : base_(std::move(base))
+    {
+        dimensions_.reserve(ranges.size());
+        for (auto& range : ranges)
+            dimensions_.push_back(resolve(std::move(range)));
+
+        size_ = 1;
+        for (const auto& dimension : dimensions_)
+        {
+            if (size_ > std::numeric_limits<std::size_t>::max() / dimension.range.values.size())
+                throw std::invalid_argument("MemSpecSweep: too many points");
+            size_ *= dimension.range.values.size();
+        }
+    }
+
+    const MemSpecVariant& base() const noexcept { return base_; }
+
+    // Number of points of the cartesian product
+    std::size_t size() const noexcept { return size_; }
+
+    std::size_t dimensions() const noexcept { return dimensions_.size(); }
+
+    const Range& range(std::size_t dimension) const { return dimensions_[dimension].range; }
+
+    // Point with the given position in the product, the last range changes fastest
+    Point point(std::size_t index) const
+    {
+        if (index >= size_)
+            throw std::out_of_range("MemSpecSweep: point " + std::to_string(index) + " out of range");
+        Point result(dimensions_.size());
+        for (std::size_t d = dimensions_.size(); d-- > 0;)
+        {
+            result[d] = index % dimensions_[d].range.values.size();
+            index /= dimensions_[d].range.values.size();
+        }
+        return result;
+    }
+
+    // Copy of the base with the values of point applied
+    MemSpecVariant make(const Point& point) const
+    {
+        if (point.size() != dimensions_.size())
+            throw std::invalid_argument("MemSpecSweep: point has the wrong number of dimensions");
+        MemSpecVariant result = base_;
+        for (std::size_t d = 0; d < dimensions_.size(); ++d)
+            dimensions_[d].apply(result, dimensions_[d].range.values.at(point[d]));
+        return result;
+    }
+
+    MemSpecVariant at(std::size_t index) const { return make(point(index)); }
+
+    /**
+     * @brief Latin hypercube sample of the product: every range is split into samples strata
+     *        of equal width and every stratum is hit by exactly one point. Ranges with fewer
+     *        values than samples repeat values evenly. The sample only depends on seed.
+     */
+    std::vector<Point> latinHypercube(std::size_t samples, std::uint64_t seed) const
+    {
+        std::vector<Point> points(samples, Point(dimensions_.size()));
+        std::uint64_t state = seed;
+        std::vector<std::size_t> strata(samples);
+        for (std::size_t d = 0; d < dimensions_.size(); ++d)
+        {
+            const std::size_t count = dimensions_[d].range.values.size();
+            std::iota(strata.begin(), strata.end(), std::size_t{0});
+            // Fisher-Yates with a fixed generator keeps samples identical across platforms
+            for (std::size_t i = samples; i > 1; --i)
+                std::swap(strata[i - 1], strata[next(state) % i]);
+            for (std::size_t s = 0; s < samples; ++s)
+            {
+                const double position = (static_cast<double>(strata[s]) + unit(state)) / static_cast<double>(samples);
+                points[s][d] = std::min(count - 1, static_cast<std::size_t>(position * static_cast<double>(count)));
+            }
+        }
+        return points;
+    }
+
+    // Lazy iteration over the cartesian product
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = MemSpecVariant;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const MemSpecVariant*;
+        using reference = const MemSpecVariant&;
+
+        reference operator*() const noexcept { return current_; }
+        pointer operator->() const noexcept { return &current_; }
+
+        // Value index per range of the current point
+        const Point& point() const noexcept { return point_; }
+        std::size_t index() const noexcept { return index_; }
+
+        iterator& operator++()
+        {
+            if (++index_ == sweep_->size_)
+                return *this;
+            // Odometer, only the ranges that change are written
+            for (std::size_t d = point_.size(); d-- > 0;)
+            {
+                const auto& dimension = sweep_->dimensions_[d];
+                const bool carry = ++point_[d] == dimension.range.values.size();
+                if (carry)
+                    point_[d] = 0;
+                dimension.apply(current_, dimension.range.values[point_[d]]);
+                if (!carry)
+                    break;
+            }
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept { return lhs.index_ == rhs.index_; }
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept { return lhs.index_ != rhs.index_; }
+
+    private:
+        friend class MemSpecSweep;
+
+        iterator(const MemSpecSweep& sweep, std::size_t index)
+            : sweep_(&sweep)
+            , index_(index)
+        {
+            if (index_ < sweep.size_)
+            {
+                point_ = sweep.point(index_);
+                current_ = sweep.make(point_);
+            }
+        }
+
+        const MemSpecSweep* sweep_;
+        std::size_t index_;
+        Point point_;
+        MemSpecVariant current_;
+    };
+
+    iterator begin() const { return iterator(*this, 0); }
+    iterator end() const { return iterator(*this, size_); }
+
+private:
+    struct Dimension
+    {
+        Range range;
+        std::function<void(MemSpecVariant&, double)> apply;
+    };
+
+    Dimension resolve(Range range) const
+    {
+        if (range.values.empty())
+            throw std::invalid_argument("MemSpecSweep: no values for " + range.field);
+
+        Dimension dimension{std::move(range), {}};
+        const std::string& field = dimension.range.field;
+        std::visit([&dimension, &field](const auto& standard) {
+            using T = std::decay_t<decltype(standard)>;
+            detail::SweepTarget<T> target = detail::sweep_target<T>(field);
+            if (!target)
+                throw std::invalid_argument("MemSpecSweep: " + field + " is no numeric field of " + std::string(T::id));
+            for (const double value : dimension.range.values)
+            {
+                if (!(value >= target.lowest && value < target.limit) || (target.integral && value != std::floor(value)))
+                    throw std::invalid_argument("MemSpecSweep: " + std::to_string(value) + " is no valid value of " + field);
+            }
+            dimension.apply = [set = std::move(target.set)](MemSpecVariant& memspec, double value) {
+                set(*std::get_if<T>(&memspec.getVariant()), value);
+            };
+        }, base_.getVariant());
+        return dimension;
+    }
+
+    // splitmix64
+    static std::uint64_t next(std::uint64_t& state) noexcept
+    {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, 1)
+    static double unit(std::uint64_t& state) noexcept
+    {
+        return static_cast<double>(next(state) >> 11) * 0x1.0p-53;
+    }
+
+    MemSpecVariant base_;
+    std::vector<Dimension> dimensions_;
+    std::size_t size_ = 1;
+};
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECSWEEP_H */
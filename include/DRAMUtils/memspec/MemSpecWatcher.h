@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_MEMSPEC_MEMSPECWATCHER_H
+#define DRAMUTILS_MEMSPEC_MEMSPECWATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/util/atomic_shared_ptr.h"
+
+#if defined(__linux__)
+#define DRAMUTILS_HAS_INOTIFY 1
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#define DRAMUTILS_HAS_INOTIFY 0
+#endif
+
+namespace DRAMUtils::MemSpec
+{
+
+/**
+ * @brief Keeps the MemSpec of a file up to date for long running processes.
+ *        A background thread waits for changes of the file (inotify on Linux, polling of the
+ *        modification time otherwise) and re-parses an owned copy of the file with
+ *        parse_memspec_from_buffer_checked.
+ *        A new version is only published if it parses and passes the optional validator.
+ *        Publishing swaps an immutable snapshot atomically, readers never wait for a reload and
+ *        keep the snapshot they hold.
+ */
+class MemSpecWatcher
+{
+public:
+    using Snapshot = std::shared_ptr<const MemSpecVariant>;
+    // Returns false to reject a parsed MemSpec
+    using Validator = std::function<bool(const MemSpecVariant&)>;
+    // Called from the watcher thread if a changed file is rejected
+    using ErrorHandler = std::function<void(const util::ParseError&)>;
+
+    /**
+     * @brief Loads the file and starts watching it.
+     *        Throws std::runtime_error if the initial version cannot be loaded.
+     * 
+     * @param interval Polling interval on platforms without inotify.
+     */
+    explicit MemSpecWatcher(std::filesystem::path path,
+                            std::string_view key = DRAMUtils::detail::keys::memSpec,
+                            Validator validator = {},
+                            ErrorHandler onError = {},
+                            std::chrono::milliseconds interval = std::chrono::milliseconds(500)) :
+        path_(std::move(path)),
+        key_(key),
+        validator_(std::move(validator)),
+        onError_(std::move(onError)),
+        interval_(interval)
+    {
+        // The watch is installed before the initial load, so no change is missed in between
+#if DRAMUTILS_HAS_INOTIFY
+        stopFd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (stopFd_ < 0)
+            throw std::system_error(errno, std::generic_category(), "MemSpecWatcher: eventfd");
+        inotifyFd_ = addWatch();
+#endif
+        std::error_code ec;
+        lastWrite_ = std::filesystem::last_write_time(path_, ec);
+
+        util::ParseError error;
+        if (!reload(&error))
+        {
+            closeFds();
+            throw std::runtime_error("MemSpecWatcher: cannot load " + path_.string() + ": " + error.message());
+        }
+        thread_ = std::thread([this] { run(); });
+    }
+
+    ~MemSpecWatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        stopped_.notify_all();
+#if DRAMUTILS_HAS_INOTIFY
+        const std::uint64_t one = 1;
+        [[maybe_unused]] const auto written = ::write(stopFd_, &one, sizeof(one));
+#endif
+        thread_.join();
+        closeFds();
+    }
+
+    MemSpecWatcher(const MemSpecWatcher&) = delete;
+    MemSpecWatcher& operator=(const MemSpecWatcher&) = delete;
+
+    // Latest published version, never nullptr
+    Snapshot current() const noexcept { return current_.load(); }
+
+    // Number of published versions, starts at 1
+    std::uint64_t version() const noexcept { return version_.load(std::memory_order_acquire); }
+
+    const std::filesystem::path& path() const noexcept { return path_; }
+
+    /**
+     * @brief Re-parses the file in the calling thread and publishes it if it is valid.
+     * 
+     * @return false if the file was rejected, the error is written to error if given.
+     */
+    bool reload(util::ParseError* error = nullptr)
+    {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+        auto parsed = parseFile();
+        if (!parsed)
+        {
+            if (error)
+                *error = std::move(parsed.error());
+            return false;
+        }
+        if (validator_ && !validator_(*parsed))
+        {
+            if (error)
+            {
+                *error = util::ParseError{};
+                error->status = util::ParseStatus::InvalidValue;
+                error->expected = "MemSpec accepted by the validator";
+            }
+            return false;
+        }
+
+        current_.store(std::make_shared<const MemSpecVariant>(std::move(*parsed)));
+        version_.fetch_add(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+private:
+    // The file is read into an owned buffer instead of being mapped: a writer truncating the
+    // file in place during the parse would raise SIGBUS on the mapped pages.
+    MemSpecResult parseFile() const
+    {
+        std::string buffer;
+        try
+        {
+            std::ifstream file(path_, std::ios::binary);
+            if (file.is_open())
+                buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            if (!file.is_open() || file.bad())
+            {
+                util::ParseError error;
+                error.status = util::ParseStatus::FileError;
+                return util::unexpected(std::move(error));
+            }
+        }
+        catch (std::exception&)
+        {
+            util::ParseError error;
+            error.status = util::ParseStatus::FileError;
+            return util::unexpected(std::move(error));
+        }
+        return parse_memspec_from_buffer_checked(buffer, key_);
+    }
+
+    void changed()
+    {
+        util::ParseError error;
+        if (!reload(&error) && onError_)
+            onError_(error);
+    }
+
+    void run()
+    {
+#if DRAMUTILS_HAS_INOTIFY
+        if (inotifyFd_ >= 0)
+            return watchInotify();
+#endif
+        poll();
+    }
+
+    void closeFds() noexcept
+    {
+#if DRAMUTILS_HAS_INOTIFY
+        if (inotifyFd_ >= 0)
+            ::close(inotifyFd_);
+        ::close(stopFd_);
+#endif
+    }
+
+#if DRAMUTILS_HAS_INOTIFY
+    // Watches the directory, so files replaced by a rename are noticed as well.
+    // Returns -1 if inotify is not available.
+    int addWatch() const noexcept
+    {
+        const int fd = ::inotify_init1(IN_CLOEXEC);
+        if (fd < 0)
+            return -1;
+        auto directory = path_.parent_path();
+        if (directory.empty())
+            directory = ".";
+        if (::inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    void watchInotify()
+    {
+        const std::string name = path_.filename().string();
+        alignas(inotify_event) char buffer[4096];
+        pollfd fds[2] = {{inotifyFd_, POLLIN, 0}, {stopFd_, POLLIN, 0}};
+        while (true)
+        {
+            if (::poll(fds, 2, -1) < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+            if (fds[1].revents)
+                break;
+
+            const auto size = ::read(inotifyFd_, buffer, sizeof(buffer));
+            if (size <= 0)
+                continue;
+
+            bool modified = false;
+            for (const char* it = buffer; it < buffer + size;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(it);
+                modified = modified || (event->len > 0 && name == event->name);
+                it += sizeof(inotify_event) + event->len;
+            }
+            if (modified)
+                changed();
+        }
+    }
+#endif
+
+    void poll()
+    {
+        std::error_code ec;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopped_.wait_for(lock, interval_, [this] { return stop_; }))
+        {
+            const auto time = std::filesystem::last_write_time(path_, ec);
+            if (ec || time == lastWrite_)
+                continue;
+            lastWrite_ = time;
+            lock.unlock();
+            changed();
+            lock.lock();
+        }
+    }
+
+    const std::filesystem::path path_;
+    const std::string key_;
+    const Validator validator_;
+    const ErrorHandler onError_;
+    const std::chrono::milliseconds interval_;
+
+    util::AtomicSharedPtr<const MemSpecVariant> current_;
+    std::atomic<std::uint64_t> version_{0};
+    std::mutex reloadMutex_;
+
+    std::mutex mutex_;
+    std::condition_variable stopped_;
+    bool stop_ = false;
+    std::filesystem::file_time_type lastWrite_;
+#if DRAMUTILS_HAS_INOTIFY
+    int inotifyFd_ = -1;
+    int stopFd_ = -1;
+#endif
+    std::thread thread_;
+};
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_MEMSPECWATCHER_H */
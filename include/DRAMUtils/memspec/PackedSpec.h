@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_MEMSPEC_PACKEDSPEC_H
+#define DRAMUTILS_MEMSPEC_PACKEDSPEC_H
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/util/macros.h"
+
+namespace DRAMUtils::MemSpec::detail
+{
+
+// Type of a field in a packed spec, floating point values keep their type
+template <typename Source, typename Int>
+struct PackedField
+{
+    using type = Int;
+};
+
+template <typename Int>
+struct PackedField<double, Int>
+{
+    using type = double;
+};
+
+// Absent optional fields are stored as the maximum value of the packed type
+template <typename Int>
+constexpr Int packed_absent = std::numeric_limits<Int>::max();
+
+template <typename Int>
+[[noreturn]] inline void throw_packed_range(const char* spec, const char* field, std::uint64_t value)
+{
+    throw std::out_of_range(std::string(spec) + "::" + field + " = " + std::to_string(value) +
+                            " does not fit into " + std::to_string(sizeof(Int) * 8) + " bits");
+}
+
+template <typename Int>
+inline void pack_field(std::uint64_t value, Int& packed, const char* spec, const char* field)
+{
+    if (value > std::numeric_limits<Int>::max())
+        throw_packed_range<Int>(spec, field, value);
+    packed = static_cast<Int>(value);
+}
+
+template <typename Int>
+inline void pack_field(const std::optional<std::uint64_t>& value, Int& packed, const char* spec, const char* field)
+{
+    if (!value)
+        packed = packed_absent<Int>;
+    else if (*value >= packed_absent<Int>)
+        throw_packed_range<Int>(spec, field, *value);
+    else
+        packed = static_cast<Int>(*value);
+}
+
+template <typename Int>
+inline void pack_field(bool value, Int& packed, const char*, const char*) noexcept
+{
+    packed = value ? 1 : 0;
+}
+
+inline void pack_field(double value, double& packed, const char*, const char*) noexcept
+{
+    packed = value;
+}
+
+template <typename Int>
+constexpr void unpack_field(Int packed, std::uint64_t& value) noexcept
+{
+    value = packed;
+}
+
+template <typename Int>
+constexpr void unpack_field(Int packed, std::optional<std::uint64_t>& value) noexcept
+{
+    if (packed == packed_absent<Int>)
+        value.reset();
+    else
+        value = packed;
+}
+
+template <typename Int>
+constexpr void unpack_field(Int packed, bool& value) noexcept
+{
+    value = packed != 0;
+}
+
+constexpr void unpack_field(double packed, double& value) noexcept
+{
+    value = packed;
+}
+
+} // namespace DRAMUtils::MemSpec::detail
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+
+#define DRAMUTILS_PACKED_SPEC_FIELD(v1) \
+    typename DRAMUtils::MemSpec::detail::PackedField<decltype(Source::v1), value_type>::type v1;
+#define DRAMUTILS_PACKED_SPEC_NAME(v1) #v1,
+#define DRAMUTILS_PACKED_SPEC_PACK(v1) \
+    DRAMUtils::MemSpec::detail::pack_field(spec.v1, packed.v1, name, #v1);
+#define DRAMUTILS_PACKED_SPEC_UNPACK(v1) \
+    DRAMUtils::MemSpec::detail::unpack_field(packed.v1, spec.v1);
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+// Declares the struct Packed holding the listed fields of Type as Int, double fields keep their
+// type. pack(const Type&) throws std::out_of_range if a value does not fit into Int,
+// unpack(const Packed&) restores the original struct. Packed specs are meant to be copied into
+// simulation models, e.g. per bank, and must not exceed two cache lines.
+// Absent optional fields are stored as std::numeric_limits<Int>::max(), bools as 0 and 1.
+// The fields must match the NLOHMANN_JSONIFY_ALL_THINGS field list of Type, which is checked at
+// compile time, so unpack never leaves a field value initialized.
+#define DRAMUTILS_DECLARE_PACKED_SPEC(Packed, Type, Int, ...)                                      \
+    struct Packed                                                                                  \
+    {                                                                                              \
+        using Source = Type;                                                                       \
+        using value_type = Int;                                                                    \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(DRAMUTILS_PACKED_SPEC_FIELD, __VA_ARGS__))                \
+        static constexpr std::string_view names[] = {                                             \
+            DRAMUTILS_EXPAND(DRAMUTILS_PASTE(DRAMUTILS_PACKED_SPEC_NAME, __VA_ARGS__))};           \
+    };                                                                                             \
+    static_assert(DRAMUtils::util::lists_fields<Type>(Packed::names),                              \
+                  #Packed " must list all fields of " #Type " in declaration order");              \
+    static_assert(sizeof(Packed) <= 128, #Packed " exceeds two cache lines");                      \
+    inline Packed pack(const Type& spec)                                                           \
+    {                                                                                              \
+        static constexpr const char* name = #Type;                                                 \
+        Packed packed{};                                                                           \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(DRAMUTILS_PACKED_SPEC_PACK, __VA_ARGS__))                 \
+        return packed;                                                                             \
+    }                                                                                              \
+    inline Type unpack(const Packed& packed) noexcept                                              \
+    {                                                                                              \
+        Type spec{};                                                                               \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(DRAMUTILS_PACKED_SPEC_UNPACK, __VA_ARGS__))               \
+        return spec;                                                                               \
+    }
+
+#endif /* DRAMUTILS_MEMSPEC_PACKEDSPEC_H */
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_MEMSPEC_TIMINGCHECKER_H
+#define DRAMUTILS_MEMSPEC_TIMINGCHECKER_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "DRAMUtils/memspec/ActivateWindow.h"
+
+namespace DRAMUtils::MemSpec
+{
+
+// Commands checked by the TimingChecker
+enum class TimingCommand : std::size_t
+{
+    ACT,
+    PRE,    // Precharge of a single bank
+    RD,
+    RDA,    // Read with auto precharge
+    WR,
+    WRA,    // Write with auto precharge
+    REFAB,  // All bank refresh
+    REFPB,  // Per bank (LPDDR4, LPDDR5) or same bank (DDR5) refresh
+    Count
+};
+
+// Relation between the bank of a previous command and the bank of the next command
+enum class TimingScope : std::size_t
+{
+    SameBank,
+    SameBankGroup,
+    SameRank,
+    OtherRank,
+    Count
+};
+
+/**
+ * @brief Minimum distances in clock cycles between a previous and a next command, for every
+ *        TimingScope, 0 if the commands are not constrained. The distances of one next command are
+ *        stored contiguously.
+ *        A constraint of a wider scope also applies to the narrower scopes, e.g. tRRD_S applies to
+ *        activates of the same bank group as well, it only has to be stored once.
+ */
+class ConstraintMatrix
+{
+public:
+    static constexpr std::size_t commands = static_cast<std::size_t>(TimingCommand::Count);
+    static constexpr std::size_t scopes = static_cast<std::size_t>(TimingScope::Count);
+    using Distances = std::array<std::uint32_t, commands * commands * scopes>;
+
+    std::uint32_t distance(TimingCommand previous, TimingCommand next, TimingScope scope) const noexcept {
+        return distances_[index(previous, next, scope)];
+    }
+
+    // Distances of all previous commands to next in scope, indexed by TimingCommand
+    const std::uint32_t* row(TimingCommand next, TimingScope scope) const noexcept {
+        return distances_.data() + index(TimingCommand{0}, next, scope);
+    }
+
+    // Raises the distance to at least cycles, negative distances are ignored
+    void require(TimingCommand previous, TimingCommand next, TimingScope scope, std::int64_t cycles) noexcept
+    {
+        auto& distance = distances_[index(previous, next, scope)];
+        if (cycles > static_cast<std::int64_t>(distance))
+            distance = static_cast<std::uint32_t>(std::min<std::int64_t>(cycles, std::numeric_limits<std::uint32_t>::max()));
+    }
+
+    // Window of four activates per rank, 0 if not constrained
+    std::uint32_t faw() const noexcept { return faw_; }
+    void setFaw(std::uint32_t faw) noexcept { faw_ = faw; }
+
+    const Distances& allDistances() const noexcept { return distances_; }
+
+private:
+    static std::size_t index(TimingCommand previous, TimingCommand next, TimingScope scope) noexcept {
+        return (static_cast<std::size_t>(next) * scopes + static_cast<std::size_t>(scope)) * commands
+               + static_cast<std::size_t>(previous);
+    }
+
+    Distances distances_{};
+    std::uint32_t faw_ = 0;
+};
+
+// Bank of a command, bank is the index inside of the bank group
+struct BankAddress
+{
+    std::size_t rank = 0;
+    std::size_t bankGroup = 0;
+    std::size_t bank = 0;
+};
+
+/**
+ * @brief Tracks the issue times of the previous commands and answers the earliest legal issue
+ *        time of a command from a ConstraintMatrix. Queries and updates take constant time,
+ *        independent of the number of banks and ranks.
+ *        The checker only covers timing, the bank state machine is left to the caller.
+ *        Checkers are created with make_timing_checker(const MemSpec<Standard>&) for DDR4, DDR5,
+ *        LPDDR4 and LPDDR5, or from a custom matrix.
+ */
+class TimingChecker
+{
+public:
+    static constexpr std::size_t commands = ConstraintMatrix::commands;
+
+    // Throws std::invalid_argument if a dimension is 0
+    TimingChecker(const ConstraintMatrix& matrix, std::size_t ranks, std::size_t bankGroups, std::size_t banksPerGroup) :
+        matrix_(matrix),
+        ranks_(ranks),
+        bankGroups_(bankGroups),
+        banksPerGroup_(banksPerGroup)
+    {
+        if (ranks == 0 || bankGroups == 0 || banksPerGroup == 0)
+            throw std::invalid_argument("TimingChecker: ranks, bank groups and banks per group must not be 0");
+        const auto& distances = matrix.allDistances();
+        for (std::size_t i = 0; i < distances.size(); ++i)
+            offsets_[i] = distances[i] != 0 ? static_cast<std::int64_t>(distances[i]) : Never;
+        reset();
+    }
+
+    // Earliest cycle the command can be issued to the bank
+    std::uint64_t earliest(TimingCommand command, const BankAddress& address) const noexcept
+    {
+        std::int64_t time = 0;
+        const auto apply = [&](const Times& last, TimingScope scope) {
+            const std::int64_t* offsets = row(command, scope);
+            for (std::size_t previous = 0; previous < commands; ++previous)
+                time = std::max(time, last[previous] + offsets[previous]);
+        };
+
+        apply(bankTimes_[bankIndex(address)], TimingScope::SameBank);
+        apply(groupTimes_[groupIndex(address)], TimingScope::SameBankGroup);
+        apply(rankTimes_[address.rank], TimingScope::SameRank);
+
+        Times otherRank;
+        for (std::size_t previous = 0; previous < commands; ++previous)
+            otherRank[previous] = latest_[previous].other(address.rank);
+        apply(otherRank, TimingScope::OtherRank);
+
+        if (command == TimingCommand::ACT)
+            time = std::max(time, static_cast<std::int64_t>(activates_[address.rank].earliestNextAct()));
+        return static_cast<std::uint64_t>(time);
+    }
+
+    bool isLegal(TimingCommand command, const BankAddress& address, std::uint64_t time) const noexcept {
+        return time >= earliest(command, address);
+    }
+
+    // Records the command, issue times must not decrease
+    void issue(TimingCommand command, const BankAddress& address, std::uint64_t time) noexcept
+    {
+        const auto t = static_cast<std::int64_t>(time);
+        const auto index = static_cast<std::size_t>(command);
+        bankTimes_[bankIndex(address)][index] = t;
+        groupTimes_[groupIndex(address)][index] = t;
+        rankTimes_[address.rank][index] = t;
+        latest_[index].update(t, address.rank);
+
+        if (command == TimingCommand::ACT)
+            activates_[address.rank].activate(time);
+    }
+
+    // Forgets all previous commands
+    void reset()
+    {
+        Times never;
+        never.fill(Never);
+        bankTimes_.assign(ranks_ * bankGroups_ * banksPerGroup_, never);
+        groupTimes_.assign(ranks_ * bankGroups_, never);
+        rankTimes_.assign(ranks_, never);
+        latest_.fill(Latest{});
+        activates_.assign(ranks_, ActivateWindow<>(matrix_.faw()));
+    }
+
+    const ConstraintMatrix& matrix() const noexcept { return matrix_; }
+
+private:
+    // Far enough in the past that no distance reaches 0, also used as the offset of unconstrained
+    // commands. Never + Never does not overflow.
+    static constexpr std::int64_t Never = std::numeric_limits<std::int64_t>::min() / 2;
+    using Times = std::array<std::int64_t, commands>;
+    using Offsets = std::array<std::int64_t, std::tuple_size_v<ConstraintMatrix::Distances>>;
+
+    // Last issue time of a command and the last issue time in any other rank
+    struct Latest
+    {
+        std::int64_t time = Never;
+        std::size_t rank = 0;
+        std::int64_t otherTime = Never;
+
+        std::int64_t other(std::size_t r) const noexcept { return r == rank ? otherTime : time; }
+
+        void update(std::int64_t t, std::size_t r) noexcept
+        {
+            if (r != rank)
+                otherTime = time;
+            time = t;
+            rank = r;
+        }
+    };
+
+    const std::int64_t* row(TimingCommand next, TimingScope scope) const noexcept {
+        return offsets_.data() + (matrix_.row(next, scope) - matrix_.allDistances().data());
+    }
+
+    std::size_t groupIndex(const BankAddress& address) const noexcept {
+        return address.rank * bankGroups_ + address.bankGroup;
+    }
+
+    std::size_t bankIndex(const BankAddress& address) const noexcept {
+        return groupIndex(address) * banksPerGroup_ + address.bank;
+    }
+
+    ConstraintMatrix matrix_;
+    Offsets offsets_{};
+    std::size_t ranks_;
+    std::size_t bankGroups_;
+    std::size_t banksPerGroup_;
+
+    std::vector<Times> bankTimes_;
+    std::vector<Times> groupTimes_;
+    std::vector<Times> rankTimes_;
+    std::array<Latest, commands> latest_{};
+    std::vector<ActivateWindow<>> activates_;
+};
+
+namespace detail
+{
+
+// Command to command timings in clock cycles
+struct CommandTimings
+{
+    std::uint64_t RCDRD;    // ACT to RD
+    std::uint64_t RCDWR;    // ACT to WR
+    std::uint64_t RP;
+    std::uint64_t RAS;
+    std::uint64_t RC;
+    std::uint64_t RL;
+    std::uint64_t WL;
+    std::uint64_t burst;    // Data burst on the bus
+    std::uint64_t RDPRE;    // RD to PRE of the same bank
+    std::uint64_t WR;       // Write recovery after the burst
+    std::uint64_t CCD_L;
+    std::uint64_t CCD_S;
+    std::uint64_t CCD_L_WR; // WR to WR in the same bank group
+    std::uint64_t RRD_L;
+    std::uint64_t RRD_S;
+    std::uint64_t FAW;
+    std::uint64_t WTR_L;
+    std::uint64_t WTR_S;
+    std::uint64_t RTRS;     // Rank to rank switch
+    std::uint64_t RFC;
+    std::uint64_t RFCpb;
+    std::uint64_t REFPBACT;   // REFPB to ACT of another bank
+    std::uint64_t REFPBREFPB; // REFPB to REFPB of another bank
+};
+
+inline ConstraintMatrix make_constraint_matrix(const CommandTimings& t) noexcept
+{
+    using C = TimingCommand;
+    using S = TimingScope;
+    ConstraintMatrix m;
+    const auto i = [](std::uint64_t v) { return static_cast<std::int64_t>(v); };
+    const auto require = [&m](std::initializer_list<C> previous, std::initializer_list<C> next, S scope, std::int64_t cycles) {
+        for (const C p : previous)
+            for (const C n : next)
+                m.require(p, n, scope, cycles);
+    };
+
+    const auto reads = {C::RD, C::RDA};
+    const auto writes = {C::WR, C::WRA};
+
+    const std::int64_t readToPre = i(t.RDPRE);
+    const std::int64_t writeToPre = i(t.WL + t.burst + t.WR);
+
+    // Same bank
+    require({C::ACT}, {C::ACT, C::REFPB}, S::SameBank, i(t.RC));
+    require({C::ACT}, reads, S::SameBank, i(t.RCDRD));
+    require({C::ACT}, writes, S::SameBank, i(t.RCDWR));
+    require({C::ACT}, {C::PRE}, S::SameBank, i(t.RAS));
+    require({C::PRE}, {C::ACT, C::REFPB}, S::SameBank, i(t.RP));
+    require({C::RD}, {C::PRE}, S::SameBank, readToPre);
+    require({C::WR}, {C::PRE}, S::SameBank, writeToPre);
+    require({C::RDA}, {C::ACT, C::REFPB}, S::SameBank, readToPre + i(t.RP));
+    require({C::WRA}, {C::ACT, C::REFPB}, S::SameBank, writeToPre + i(t.RP));
+    require({C::REFPB}, {C::ACT, C::REFPB}, S::SameBank, i(t.RFCpb));
+
+    // Same bank group
+    require({C::ACT}, {C::ACT}, S::SameBankGroup, i(t.RRD_L));
+    require(reads, reads, S::SameBankGroup, i(t.CCD_L));
+    require(writes, writes, S::SameBankGroup, i(t.CCD_L_WR));
+    require(writes, reads, S::SameBankGroup, i(t.WL + t.burst + t.WTR_L));
+
+    // Same rank
+    require({C::ACT}, {C::ACT, C::REFPB}, S::SameRank, i(t.RRD_S));
+    require(reads, reads, S::SameRank, i(t.CCD_S));
+    require(writes, writes, S::SameRank, i(t.CCD_S));
+    require(writes, reads, S::SameRank, i(t.WL + t.burst + t.WTR_S));
+    require(reads, writes, S::SameRank, i(t.RL + t.burst + t.RTRS) - i(t.WL));
+    require({C::ACT}, {C::REFAB}, S::SameRank, i(t.RC));
+    require({C::PRE}, {C::REFAB}, S::SameRank, i(t.RP));
+    require({C::RDA}, {C::REFAB}, S::SameRank, readToPre + i(t.RP));
+    require({C::WRA}, {C::REFAB}, S::SameRank, writeToPre + i(t.RP));
+    require({C::REFAB}, {C::ACT, C::REFAB, C::REFPB}, S::SameRank, i(t.RFC));
+    require({C::REFPB}, {C::REFAB}, S::SameRank, i(t.RFCpb));
+    require({C::REFPB}, {C::ACT}, S::SameRank, i(t.REFPBACT));
+    require({C::REFPB}, {C::REFPB}, S::SameRank, i(t.REFPBREFPB));
+
+    // Other rank, only the shared data bus
+    require(reads, reads, S::OtherRank, i(t.burst + t.RTRS));
+    require(writes, writes, S::OtherRank, i(t.burst + t.RTRS));
+    require(reads, writes, S::OtherRank, i(t.RL + t.burst + t.RTRS) - i(t.WL));
+    require(writes, reads, S::OtherRank, i(t.WL + t.burst + t.RTRS) - i(t.RL));
+
+    m.setFaw(static_cast<std::uint32_t>(t.FAW));
+    return m;
+}
+
+// nbrOfBanks is the number of banks per rank, standards without bank groups have 0 or 1
+inline TimingChecker make_timing_checker(const ConstraintMatrix& matrix, std::uint64_t ranks, std::uint64_t bankGroups, std::uint64_t banks)
+{
+    const std::uint64_t groups = std::max<std::uint64_t>(bankGroups, 1);
+    return TimingChecker(matrix, ranks, groups, banks / groups);
+}
+
+} // namespace detail
+
+} // namespace DRAMUtils::MemSpec
+
+#endif /* DRAMUTILS_MEMSPEC_TIMINGCHECKER_H */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_MEMSPEC_TIMINGTABLE_H
+#define DRAMUTILS_MEMSPEC_TIMINGTABLE_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/util/macros.h"
+
+namespace DRAMUtils::MemSpec
+{
+
+/**
+ * @brief Immutable table of the timing constraints of a standard, indexed by the constraint enum
+ *        of the standard. Cycles and picoseconds are computed once when the table is created,
+ *        both are stored in contiguous arrays.
+ *        Tables are created with make_timing_table(const MemTimingSpecType<Standard>&).
+ */
+template <typename Constraint>
+class alignas(64) TimingTable
+{
+public:
+    static constexpr std::size_t size = static_cast<std::size_t>(Constraint::Count);
+    using Values = std::array<std::uint64_t, size>;
+
+    /**
+     * @param tCK The clock period of the MemTimingSpec
+     * @param cycles The constraints in clock cycles
+     * @param psPerTCK Picoseconds per unit of tCK. Defaults to 1e12, i.e. tCK is given in seconds.
+     */
+    TimingTable(double tCK, const Values& cycles, double psPerTCK = 1e12) noexcept :
+        tCK_(tCK),
+        tCKps_(toPs(1, tCK * psPerTCK)),
+        cycles_(cycles)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            ps_[i] = toPs(cycles_[i], tCK * psPerTCK);
+    }
+
+    std::uint64_t cycles(Constraint constraint) const noexcept {
+        return cycles_[static_cast<std::size_t>(constraint)];
+    }
+
+    std::uint64_t ps(Constraint constraint) const noexcept {
+        return ps_[static_cast<std::size_t>(constraint)];
+    }
+
+    double tCK() const noexcept { return tCK_; }
+    std::uint64_t tCKps() const noexcept { return tCKps_; }
+
+    const Values& allCycles() const noexcept { return cycles_; }
+    const Values& allPs() const noexcept { return ps_; }
+
+private:
+    static std::uint64_t toPs(std::uint64_t cycles, double psPerCycle) noexcept {
+        return static_cast<std::uint64_t>(std::llround(static_cast<double>(cycles) * psPerCycle));
+    }
+
+    double tCK_;
+    std::uint64_t tCKps_;
+    alignas(64) Values cycles_;
+    alignas(64) Values ps_{};
+};
+
+} // namespace DRAMUtils::MemSpec
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+
+#define DRAMUTILS_TIMING_TABLE_NAME(v1) #v1,
+#define DRAMUTILS_TIMING_TABLE_CYCLES(v1) cycles[static_cast<std::size_t>(Constraint::v1)] = spec.v1;
+
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+// Declares the constraint enum TimingConstraint<Standard>, the table TimingTable<Standard> and
+// make_timing_table for the timing spec Type. All listed fields are cycle counts, tCK is implicit.
+// The constraints must be the NLOHMANN_JSONIFY_ALL_THINGS field list of Type without tCK, which
+// is checked at compile time.
+#define DRAMUTILS_DECLARE_TIMING_TABLE(Standard, Type, ...)                                        \
+    enum class TimingConstraint##Standard : std::size_t { __VA_ARGS__, Count };                    \
+    using TimingTable##Standard = DRAMUtils::MemSpec::TimingTable<TimingConstraint##Standard>;     \
+    inline TimingTable##Standard make_timing_table(const Type& spec, double psPerTCK = 1e12)       \
+    {                                                                                              \
+        using Constraint = TimingConstraint##Standard;                                             \
+        static constexpr std::string_view names[] = {                                              \
+            DRAMUTILS_EXPAND(DRAMUTILS_PASTE(DRAMUTILS_TIMING_TABLE_NAME, __VA_ARGS__))};          \
+        static_assert(DRAMUtils::util::lists_fields<Type>(names, "tCK"),                           \
+                      "TimingConstraint" #Standard " must list all fields of " #Type " but tCK");  \
+        TimingTable##Standard::Values cycles{};                                                    \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(DRAMUTILS_TIMING_TABLE_CYCLES, __VA_ARGS__))              \
+        return TimingTable##Standard(spec.tCK, cycles, psPerTCK);                                  \
+    }
+
+#endif /* DRAMUTILS_MEMSPEC_TIMINGTABLE_H */
@@ -42,6 +42,8 @@
 
 #include "DRAMUtils/util/json_utils.h"
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 
 namespace DRAMUtils::MemSpec {
@@ -60,6 +62,7 @@ struct MemArchitectureSpecTypeDDR3
     uint64_t nbrOfDevices;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeDDR3, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, maxBurstLength, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfDevices)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeDDR3, MemArchitectureSpecTypeDDR3, uint32_t, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, maxBurstLength, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfDevices)
 
 struct MemTimingSpecDDR3
 {
@@ -92,12 +95,14 @@ struct MemTimingSpecDDR3
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecDDR3, tCK, CKE, CKESR, RAS, RC, RCD, RL, RTP, WL, WR, XP, XS, REFI, RFC, RP, DQSCK, CCD, FAW, RRD, WTR, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, REFPDEN, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(DDR3, MemTimingSpecDDR3, CKE, CKESR, RAS, RC, RCD, RL, RTP, WL, WR, XP, XS, REFI, RFC, RP, DQSCK, CCD, FAW, RRD, WTR, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, REFPDEN, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecDDR3, MemTimingSpecDDR3, uint16_t, tCK, CKE, CKESR, RAS, RC, RCD, RL, RTP, WL, WR, XP, XS, REFI, RFC, RP, DQSCK, CCD, FAW, RRD, WTR, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, REFPDEN, RTRS)
 
 struct MemSpecDDR3 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "DDR3";
 
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeDDR3 memarchitecturespec;
     MemTimingSpecDDR3 memtimingspec;
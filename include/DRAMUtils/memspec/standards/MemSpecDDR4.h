@@ -36,12 +36,18 @@
 #ifndef DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECDDR4_H
 #define DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECDDR4_H
 
+#include <array>
 #include <string_view>
 #include <string>
 #include <optional>
 #include "DRAMUtils/util/json_utils.h"
 
+#include "DRAMUtils/memspec/ActivateWindow.h"
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/EnergyTable.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingChecker.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -61,6 +67,7 @@ struct MemArchitectureSpecTypeDDR4
     std::optional<uint64_t> maxBurstLength;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeDDR4, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, RefMode, maxBurstLength)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeDDR4, MemArchitectureSpecTypeDDR4, uint32_t, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, RefMode, maxBurstLength)
 
 struct MemTimingSpecTypeDDR4
 {
@@ -101,6 +108,8 @@ struct MemTimingSpecTypeDDR4
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeDDR4, tCK, CKE, CKESR, RAS, RC, RCD, RL, RPRE, RTP, WL, WPRE, WR, XP, XS, REFM, REFI, RFC1, RFC2, RFC4, RP, DQSCK, CCD_S, CCD_L, FAW, RRD_S, RRD_L, WTR_S, WTR_L, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, REFPDEN, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(DDR4, MemTimingSpecTypeDDR4, CKE, CKESR, RAS, RC, RCD, RL, RPRE, RTP, WL, WPRE, WR, XP, XS, REFM, REFI, RFC1, RFC2, RFC4, RP, DQSCK, CCD_S, CCD_L, FAW, RRD_S, RRD_L, WTR_S, WTR_L, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, REFPDEN, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeDDR4, MemTimingSpecTypeDDR4, uint16_t, tCK, CKE, CKESR, RAS, RC, RCD, RL, RPRE, RTP, WL, WPRE, WR, XP, XS, REFM, REFI, RFC1, RFC2, RFC4, RP, DQSCK, CCD_S, CCD_L, FAW, RRD_S, RRD_L, WTR_S, WTR_L, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, REFPDEN, RTRS)
 
 struct MemPowerSpecTypeDDR4
 {
@@ -191,7 +200,7 @@ NLOHMANN_JSONIFY_ALL_THINGS(MemImpedanceSpecTypeDDR4, C_total_ck, C_total_cb, C_
 struct MemSpecDDR4 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "DDR4";
-    std::string memoryId;
+    MemoryId memoryId;
     
     MemArchitectureSpecTypeDDR4 memarchitecturespec;
     MemPowerSpecTypeDDR4 mempowerspec;
@@ -202,6 +211,60 @@ struct MemSpecDDR4 : BaseMemSpec
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemSpecDDR4, memoryId, memarchitecturespec, mempowerspec, memtimingspec, bankwisespec, memimpedancespec, prepostamble)
 
+// Energy table of a single device, refresh uses the current and tRFC of the RefMode
+inline EnergyTable make_energy_table(const MemSpecDDR4& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& p = memspec.mempowerspec;
+    const auto& t = memspec.memtimingspec;
+
+    double idd5 = p.idd5B;
+    double ipp5 = p.ipp5B;
+    uint64_t RFC = t.RFC1;
+    if (arch.RefMode == 2)
+    {
+        idd5 = p.idd5F2;
+        ipp5 = p.ipp5F2;
+        RFC = t.RFC2;
+    }
+    else if (arch.RefMode == 4)
+    {
+        idd5 = p.idd5F4;
+        ipp5 = p.ipp5F4;
+        RFC = t.RFC4;
+    }
+
+    const std::array<detail::EnergyRail, 2> rails{{
+        {p.vdd, p.idd0, p.idd2n, p.idd3n, p.idd4r, p.idd4w, idd5, 0.0, p.idd2p, p.idd3p, p.idd6n},
+        {p.vpp, p.ipp0, p.ipp2n, p.ipp3n, p.ipp4r, p.ipp4w, ipp5, 0.0, p.ipp2p, p.ipp3p, p.ipp6n},
+    }};
+    return detail::make_energy_table(rails, {t.tCK, t.RAS, t.RP, RFC, 0, detail::burst_cycles(arch.burstLength, arch.dataRate)});
+}
+
+// Constraints of a single rank, refresh uses the tRFC of the RefMode
+inline ConstraintMatrix make_constraint_matrix(const MemSpecDDR4& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& t = memspec.memtimingspec;
+
+    const uint64_t RFC = arch.RefMode == 4 ? t.RFC4 : arch.RefMode == 2 ? t.RFC2 : t.RFC1;
+    const uint64_t burst = detail::burst_cycles(arch.burstLength, arch.dataRate);
+    return detail::make_constraint_matrix({t.RCD, t.RCD, t.RP, t.RAS, t.RC, t.RL, t.WL, burst, t.RTP, t.WR,
+        t.CCD_L, t.CCD_S, t.CCD_L, t.RRD_L, t.RRD_S, t.FAW, t.WTR_L, t.WTR_S, t.RTRS, RFC, 0, 0, 0});
+}
+
+inline TimingChecker make_timing_checker(const MemSpecDDR4& memspec)
+{
+    const auto& arch = memspec.memarchitecturespec;
+    return detail::make_timing_checker(make_constraint_matrix(memspec), arch.nbrOfRanks, arch.nbrOfBankGroups, arch.nbrOfBanks);
+}
+
+// Activate window of one rank
+inline ActivateWindow<> make_activate_window(const MemSpecDDR4& memspec) noexcept
+{
+    return ActivateWindow<>(memspec.memtimingspec.FAW);
+}
+
 } // namespace DRAMUtils::MemSpec
 
 #endif /* DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECDDR4_H */
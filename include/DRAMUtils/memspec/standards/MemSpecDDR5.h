@@ -36,11 +36,18 @@
 #ifndef DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECDDR5_H
 #define DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECDDR5_H
 
+#include <algorithm>
+#include <array>
 #include <string_view>
 #include <string>
 #include "DRAMUtils/util/json_utils.h"
 
+#include "DRAMUtils/memspec/ActivateWindow.h"
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/EnergyTable.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingChecker.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -68,6 +75,7 @@ struct MemArchitectureSpecTypeDDR5
     uint64_t RAADEC;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeDDR5, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfDIMMRanks, nbrOfPhysicalRanks, nbrOfLogicalRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, RefMode, maxBurstLength, cmdMode, RAAIMT, RAAMMT, RAADEC)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeDDR5, MemArchitectureSpecTypeDDR5, uint32_t, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfDIMMRanks, nbrOfPhysicalRanks, nbrOfLogicalRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, RefMode, maxBurstLength, cmdMode, RAAIMT, RAAMMT, RAADEC)
 
 struct MemTimingSpecTypeDDR5
 {
@@ -127,6 +135,8 @@ struct MemTimingSpecTypeDDR5
     uint64_t    REFPDEN;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeDDR5, tCK, RAS, RCD, RTP, WL, WR, RP, PPD, RL, RPRE, RPST, RDDQS, WPRE, WPST, CCD_L_slr, CCD_L_WR_slr, CCD_L_WR2_slr, CCD_M_slr, CCD_M_WR_slr, CCD_S_slr, CCD_S_WR_slr, CCD_dlr, CCD_WR_dlr, CCD_WR_dpr, RRD_L_slr, RRD_S_slr, RRD_dlr, FAW_slr, FAW_dlr, WTR_L, WTR_M, WTR_S, RFC1_slr, RFC2_slr, RFC1_dlr, RFC2_dlr, RFC1_dpr, RFC2_dpr, RFCsb_slr, RFCsb_dlr, REFI1, REFI2, REFISB, REFSBRD_slr, REFSBRD_dlr, RTRS, CPDED, PD, XP, ACTPDEN, PRPDEN, REFPDEN)
+DRAMUTILS_DECLARE_TIMING_TABLE(DDR5, MemTimingSpecTypeDDR5, RAS, RCD, RTP, WL, WR, RP, PPD, RL, RPRE, RPST, RDDQS, WPRE, WPST, CCD_L_slr, CCD_L_WR_slr, CCD_L_WR2_slr, CCD_M_slr, CCD_M_WR_slr, CCD_S_slr, CCD_S_WR_slr, CCD_dlr, CCD_WR_dlr, CCD_WR_dpr, RRD_L_slr, RRD_S_slr, RRD_dlr, FAW_slr, FAW_dlr, WTR_L, WTR_M, WTR_S, RFC1_slr, RFC2_slr, RFC1_dlr, RFC2_dlr, RFC1_dpr, RFC2_dpr, RFCsb_slr, RFCsb_dlr, REFI1, REFI2, REFISB, REFSBRD_slr, REFSBRD_dlr, RTRS, CPDED, PD, XP, ACTPDEN, PRPDEN, REFPDEN)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeDDR5, MemTimingSpecTypeDDR5, uint16_t, tCK, RAS, RCD, RTP, WL, WR, RP, PPD, RL, RPRE, RPST, RDDQS, WPRE, WPST, CCD_L_slr, CCD_L_WR_slr, CCD_L_WR2_slr, CCD_M_slr, CCD_M_WR_slr, CCD_S_slr, CCD_S_WR_slr, CCD_dlr, CCD_WR_dlr, CCD_WR_dpr, RRD_L_slr, RRD_S_slr, RRD_dlr, FAW_slr, FAW_dlr, WTR_L, WTR_M, WTR_S, RFC1_slr, RFC2_slr, RFC1_dlr, RFC2_dlr, RFC1_dpr, RFC2_dpr, RFCsb_slr, RFCsb_dlr, REFI1, REFI2, REFISB, REFSBRD_slr, REFSBRD_dlr, RTRS, CPDED, PD, XP, ACTPDEN, PRPDEN, REFPDEN)
 
 struct MemPowerSpecTypeDDR5
 {
@@ -196,7 +206,7 @@ NLOHMANN_JSONIFY_ALL_THINGS(DataRateSpecTypeDDR5, ca_bus_rate, dq_bus_rate, dqs_
 struct MemSpecDDR5 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "DDR5";
-    std::string memoryId;
+    MemoryId memoryId;
     
     MemArchitectureSpecTypeDDR5 memarchitecturespec;
     MemPowerSpecTypeDDR5 mempowerspec;
@@ -207,6 +217,54 @@ struct MemSpecDDR5 : BaseMemSpec
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemSpecDDR5, memoryId, memarchitecturespec, mempowerspec, memtimingspec, bankwisespec, memimpedancespec, dataratespec)
 
+// Energy table of a single device, refresh uses the current and tRFC of the RefMode.
+// REFPB is the same bank refresh.
+inline EnergyTable make_energy_table(const MemSpecDDR5& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& p = memspec.mempowerspec;
+    const auto& t = memspec.memtimingspec;
+
+    const bool fine = arch.RefMode == 2;
+    const double idd5 = fine ? p.idd5f : p.idd5b;
+    const double ipp5 = fine ? p.ipp5f : p.ipp5b;
+    const uint64_t RFC = fine ? t.RFC2_slr : t.RFC1_slr;
+
+    const std::array<detail::EnergyRail, 2> rails{{
+        {p.vdd, p.idd0, p.idd2n, p.idd3n, p.idd4r, p.idd4w, idd5, p.idd5c, p.idd2p, p.idd3p, p.idd6n},
+        {p.vpp, p.ipp0, p.ipp2n, p.ipp3n, p.ipp4r, p.ipp4w, ipp5, p.ipp5c, p.ipp2p, p.ipp3p, p.ipp6n},
+    }};
+    return detail::make_energy_table(rails, {t.tCK, t.RAS, t.RP, RFC, t.RFCsb_slr, detail::burst_cycles(arch.burstLength, arch.dataRate)});
+}
+
+// Constraints of a single logical rank (slr timings), refresh uses the tRFC of the RefMode.
+// REFPB is the same bank refresh.
+inline ConstraintMatrix make_constraint_matrix(const MemSpecDDR5& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& t = memspec.memtimingspec;
+
+    const uint64_t RFC = arch.RefMode == 2 ? t.RFC2_slr : t.RFC1_slr;
+    const uint64_t burst = detail::burst_cycles(arch.burstLength, arch.dataRate);
+    return detail::make_constraint_matrix({t.RCD, t.RCD, t.RP, t.RAS, t.RAS + t.RP, t.RL, t.WL, burst, t.RTP, t.WR,
+        t.CCD_L_slr, t.CCD_S_slr, t.CCD_L_WR_slr, t.RRD_L_slr, t.RRD_S_slr, t.FAW_slr, t.WTR_L, t.WTR_S, t.RTRS,
+        RFC, t.RFCsb_slr, t.REFSBRD_slr, t.RFCsb_slr});
+}
+
+inline TimingChecker make_timing_checker(const MemSpecDDR5& memspec)
+{
+    const auto& arch = memspec.memarchitecturespec;
+    return detail::make_timing_checker(make_constraint_matrix(memspec), arch.nbrOfRanks, arch.nbrOfBankGroups, arch.nbrOfBanks);
+}
+
+// Activate windows of one physical rank, tFAW_slr within and tFAW_dlr across its logical ranks
+inline LogicalRankActivateWindow make_activate_window(const MemSpecDDR5& memspec)
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& t = memspec.memtimingspec;
+    return LogicalRankActivateWindow(std::max<uint64_t>(arch.nbrOfLogicalRanks, 1), t.FAW_slr, t.FAW_dlr);
+}
+
 } // namespace DRAMUtils::MemSpec
 
 #endif /* DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECDDR5_H */
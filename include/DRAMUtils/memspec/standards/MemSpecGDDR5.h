@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -59,6 +61,7 @@ struct MemArchitectureSpecTypeGDDR5
     uint64_t nbrOfBankGroups;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeGDDR5, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeGDDR5, MemArchitectureSpecTypeGDDR5, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups)
 
 struct MemTimingSpecTypeGDDR5
 {
@@ -99,11 +102,13 @@ struct MemTimingSpecTypeGDDR5
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeGDDR5, tCK, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, CL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, CKE, PD, XPN, REFI, REFIPB, RFC, RFCPB, RREFD, XS, FAW, _32AW, PPD, LK, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(GDDR5, MemTimingSpecTypeGDDR5, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, CL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, CKE, PD, XPN, REFI, REFIPB, RFC, RFCPB, RREFD, XS, FAW, _32AW, PPD, LK, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeGDDR5, MemTimingSpecTypeGDDR5, uint16_t, tCK, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, CL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, CKE, PD, XPN, REFI, REFIPB, RFC, RFCPB, RREFD, XS, FAW, _32AW, PPD, LK, RTRS)
 
 struct MemSpecGDDR5 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "GDDR5";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeGDDR5 memarchitecturespec;
     MemTimingSpecTypeGDDR5 memtimingspec;
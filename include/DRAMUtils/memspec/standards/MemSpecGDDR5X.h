@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -59,6 +61,7 @@ struct MemArchitectureSpecTypeGDDR5X
     uint64_t nbrOfBankGroups;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeGDDR5X, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeGDDR5X, MemArchitectureSpecTypeGDDR5X, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups)
 
 struct MemTimingSpecTypeGDDR5X
 {
@@ -99,11 +102,13 @@ struct MemTimingSpecTypeGDDR5X
     uint64_t    TRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeGDDR5X, tCK, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, CL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, CKE, PD, XP, REFI, REFIPB, RFC, RFCPB, RREFD, XS, FAW, _32AW, PPD, LK, TRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(GDDR5X, MemTimingSpecTypeGDDR5X, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, CL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, CKE, PD, XP, REFI, REFIPB, RFC, RFCPB, RREFD, XS, FAW, _32AW, PPD, LK, TRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeGDDR5X, MemTimingSpecTypeGDDR5X, uint16_t, tCK, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, CL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, CKE, PD, XP, REFI, REFIPB, RFC, RFCPB, RREFD, XS, FAW, _32AW, PPD, LK, TRS)
 
 struct MemSpecGDDR5X : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "GDDR5X";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeGDDR5X memarchitecturespec;
     MemTimingSpecTypeGDDR5X memtimingspec;
@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -60,6 +62,7 @@ struct MemArchitectureSpecTypeGDDR6
     uint64_t nbrOfBankGroups;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeGDDR6, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, per2BankOffset, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfDevices, nbrOfBankGroups)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeGDDR6, MemArchitectureSpecTypeGDDR6, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, per2BankOffset, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfDevices, nbrOfBankGroups)
 
 struct MemTimingSpecTypeGDDR6
 {
@@ -102,11 +105,13 @@ struct MemTimingSpecTypeGDDR6
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeGDDR6, tCK, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, RL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, PD, CKESR, XP, REFI, REFIpb, RFCab, RFCpb, RREFD, XS, FAW, PPD, LK, ACTPDE, PREPDE, REFPDE, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(GDDR6, MemTimingSpecTypeGDDR6, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, RL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, PD, CKESR, XP, REFI, REFIpb, RFCab, RFCpb, RREFD, XS, FAW, PPD, LK, ACTPDE, PREPDE, REFPDE, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeGDDR6, MemTimingSpecTypeGDDR6, uint16_t, tCK, RP, RAS, RC, RCDRD, RCDWR, RTP, RRDS, RRDL, CCDS, CCDL, RL, WCK2CKPIN, WCK2CK, WCK2DQO, RTW, WL, WCK2DQI, WR, WTRS, WTRL, PD, CKESR, XP, REFI, REFIpb, RFCab, RFCpb, RREFD, XS, FAW, PPD, LK, ACTPDE, PREPDE, REFPDE, RTRS)
 
 struct MemSpecGDDR6 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "GDDR6";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeGDDR6 memarchitecturespec;
     MemTimingSpecTypeGDDR6 memtimingspec;
@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -59,6 +61,7 @@ struct MemArchitectureSpecTypeHBM2
     uint64_t nbrOfBankGroups;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeHBM2, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfPseudoChannels, nbrOfDevices, nbrOfBanks, nbrOfBankGroups)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeHBM2, MemArchitectureSpecTypeHBM2, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfPseudoChannels, nbrOfDevices, nbrOfBanks, nbrOfBankGroups)
 
 struct MemTimingSpecTypeHBM2
 {
@@ -92,11 +95,13 @@ struct MemTimingSpecTypeHBM2
     uint64_t    REFISB;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeHBM2, tCK, DQSCK, RC, RAS, RCDRD, RCDWR, RRDL, RRDS, FAW, RTP, RP, RL, WL, PL, WR, CCDL, CCDS, WTRL, WTRS, RTW, XP, CKE, XS, RFC, RFCSB, RREFD, REFI, REFISB)
+DRAMUTILS_DECLARE_TIMING_TABLE(HBM2, MemTimingSpecTypeHBM2, DQSCK, RC, RAS, RCDRD, RCDWR, RRDL, RRDS, FAW, RTP, RP, RL, WL, PL, WR, CCDL, CCDS, WTRL, WTRS, RTW, XP, CKE, XS, RFC, RFCSB, RREFD, REFI, REFISB)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeHBM2, MemTimingSpecTypeHBM2, uint16_t, tCK, DQSCK, RC, RAS, RCDRD, RCDWR, RRDL, RRDS, FAW, RTP, RP, RL, WL, PL, WR, CCDL, CCDS, WTRL, WTRS, RTW, XP, CKE, XS, RFC, RFCSB, RREFD, REFI, REFISB)
 
 struct MemSpecHBM2 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "HBM2";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeHBM2 memarchitecturespec;
     MemTimingSpecTypeHBM2 memtimingspec;
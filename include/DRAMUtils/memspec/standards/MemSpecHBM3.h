@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -62,6 +64,7 @@ struct MemArchitectureSpecTypeHBM3
     uint64_t RAADEC;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeHBM3, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfPseudoChannels, nbrOfDevices, nbrOfBanks, nbrOfBankGroups, RAAIMT, RAAMMT, RAADEC)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeHBM3, MemArchitectureSpecTypeHBM3, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfPseudoChannels, nbrOfDevices, nbrOfBanks, nbrOfBankGroups, RAAIMT, RAAMMT, RAADEC)
 
 struct MemTimingSpecTypeHBM3
 {
@@ -96,11 +99,13 @@ struct MemTimingSpecTypeHBM3
     uint64_t    PPD;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeHBM3, tCK, DQSCK, RC, RAS, RCDRD, RCDWR, RRDL, RRDS, FAW, RTP, RP, RL, WL, PL, WR, CCDL, CCDS, WTRL, WTRS, RTW, XP, CKE, XS, RFC, RFCPB, RREFD, REFI, REFIPB, PPD)
+DRAMUTILS_DECLARE_TIMING_TABLE(HBM3, MemTimingSpecTypeHBM3, DQSCK, RC, RAS, RCDRD, RCDWR, RRDL, RRDS, FAW, RTP, RP, RL, WL, PL, WR, CCDL, CCDS, WTRL, WTRS, RTW, XP, CKE, XS, RFC, RFCPB, RREFD, REFI, REFIPB, PPD)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeHBM3, MemTimingSpecTypeHBM3, uint16_t, tCK, DQSCK, RC, RAS, RCDRD, RCDWR, RRDL, RRDS, FAW, RTP, RP, RL, WL, PL, WR, CCDL, CCDS, WTRL, WTRS, RTW, XP, CKE, XS, RFC, RFCPB, RREFD, REFI, REFIPB, PPD)
 
 struct MemSpecHBM3 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "HBM3";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeHBM3 memarchitecturespec;
     MemTimingSpecTypeHBM3 memtimingspec;
@@ -36,12 +36,18 @@
 #ifndef DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECLPDDR4_H
 #define DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECLPDDR4_H
 
+#include <array>
 #include <string_view>
 #include <string>
 #include <optional>
 #include "DRAMUtils/util/json_utils.h"
 
+#include "DRAMUtils/memspec/ActivateWindow.h"
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/EnergyTable.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingChecker.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -60,6 +66,7 @@ struct MemArchitectureSpecTypeLPDDR4
     std::optional<uint64_t> maxBurstLength;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeLPDDR4, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, maxBurstLength)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeLPDDR4, MemArchitectureSpecTypeLPDDR4, uint32_t, nbrOfChannels, nbrOfDevices, nbrOfRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, maxBurstLength)
 
 struct MemImpedanceSpecTypeLPDDR4 {
     double C_total_ck;
@@ -113,6 +120,8 @@ struct MemTimingSpecTypeLPDDR4
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeLPDDR4, tCK, CKE, ESCKE, CMDCKE, RAS, RCD, RL, REFI, REFIpb, RFCpb, RFCab, RPpb, RPab, RCpb, RCab, PPD, FAW, RRD, CCD, CCDMW, RPST, DQSCK, RTP, WL, DQSS, DQS2DQ, WR, WPRE, WTR, XP, SR, XSR, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(LPDDR4, MemTimingSpecTypeLPDDR4, CKE, ESCKE, CMDCKE, RAS, RCD, RL, REFI, REFIpb, RFCpb, RFCab, RPpb, RPab, RCpb, RCab, PPD, FAW, RRD, CCD, CCDMW, RPST, DQSCK, RTP, WL, DQSS, DQS2DQ, WR, WPRE, WTR, XP, SR, XSR, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeLPDDR4, MemTimingSpecTypeLPDDR4, uint16_t, tCK, CKE, ESCKE, CMDCKE, RAS, RCD, RL, REFI, REFIpb, RFCpb, RFCab, RPpb, RPab, RCpb, RCab, PPD, FAW, RRD, CCD, CCDMW, RPST, DQSCK, RTP, WL, DQSS, DQS2DQ, WR, WPRE, WTR, XP, SR, XSR, RTRS)
 
 enum class pasrModesType {
     PASR_0,
@@ -125,16 +134,16 @@ enum class pasrModesType {
     PASR_7,
     Invalid = -1,
 };
-NLOHMANN_JSON_SERIALIZE_ENUM(pasrModesType,
-                             {{pasrModesType::Invalid, nullptr},
-                              {pasrModesType::PASR_0, 0},
-                              {pasrModesType::PASR_1, 1},
-                              {pasrModesType::PASR_2, 2},
-                              {pasrModesType::PASR_3, 3},
-                              {pasrModesType::PASR_4, 4},
-                              {pasrModesType::PASR_5, 5},
-                              {pasrModesType::PASR_6, 6},
-                              {pasrModesType::PASR_7, 7},})
+DRAMUTILS_JSON_SERIALIZE_ENUM(pasrModesType,
+                              {{pasrModesType::Invalid, nullptr},
+                               {pasrModesType::PASR_0, 0},
+                               {pasrModesType::PASR_1, 1},
+                               {pasrModesType::PASR_2, 2},
+                               {pasrModesType::PASR_3, 3},
+                               {pasrModesType::PASR_4, 4},
+                               {pasrModesType::PASR_5, 5},
+                               {pasrModesType::PASR_6, 6},
+                               {pasrModesType::PASR_7, 7},})
 
 struct BankWiseSpecTypeLPDDR4
 {
@@ -181,7 +190,7 @@ NLOHMANN_JSONIFY_ALL_THINGS(MemPowerSpecTypeLPDDR4, vdd1, idd01, idd2n1, idd3n1,
 struct MemSpecLPDDR4 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "LPDDR4";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeLPDDR4 memarchitecturespec;
     MemPowerSpecTypeLPDDR4 mempowerspec;
@@ -191,6 +200,43 @@ struct MemSpecLPDDR4 : BaseMemSpec
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemSpecLPDDR4, memoryId, memarchitecturespec, mempowerspec, memtimingspec, memimpedancespec, bankwisespec)
 
+// Energy table of a single device, PRE is the per bank precharge
+inline EnergyTable make_energy_table(const MemSpecLPDDR4& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& p = memspec.mempowerspec;
+    const auto& t = memspec.memtimingspec;
+
+    const std::array<detail::EnergyRail, 2> rails{{
+        {p.vdd1, p.idd01, p.idd2n1, p.idd3n1, p.idd4r1, p.idd4w1, p.idd51, p.idd5pb1, p.idd2p1, p.idd3p1, p.idd61},
+        {p.vdd2, p.idd02, p.idd2n2, p.idd3n2, p.idd4r2, p.idd4w2, p.idd52, p.idd5pb2, p.idd2p2, p.idd3p2, p.idd62},
+    }};
+    return detail::make_energy_table(rails, {t.tCK, t.RAS, t.RPpb, t.RFCab, t.RFCpb, detail::burst_cycles(arch.burstLength, arch.dataRate)});
+}
+
+// Constraints of a single rank, precharges and REFPB use the per bank timings
+inline ConstraintMatrix make_constraint_matrix(const MemSpecLPDDR4& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& t = memspec.memtimingspec;
+
+    const uint64_t burst = detail::burst_cycles(arch.burstLength, arch.dataRate);
+    return detail::make_constraint_matrix({t.RCD, t.RCD, t.RPpb, t.RAS, t.RCpb, t.RL, t.WL, burst, t.RTP, t.WR,
+        t.CCD, t.CCD, t.CCD, t.RRD, t.RRD, t.FAW, t.WTR, t.WTR, t.RTRS, t.RFCab, t.RFCpb, t.RRD, t.RFCpb});
+}
+
+inline TimingChecker make_timing_checker(const MemSpecLPDDR4& memspec)
+{
+    const auto& arch = memspec.memarchitecturespec;
+    return detail::make_timing_checker(make_constraint_matrix(memspec), arch.nbrOfRanks, arch.nbrOfBankGroups, arch.nbrOfBanks);
+}
+
+// Activate window of one rank
+inline ActivateWindow<> make_activate_window(const MemSpecLPDDR4& memspec) noexcept
+{
+    return ActivateWindow<>(memspec.memtimingspec.FAW);
+}
+
 } // namespace DRAMUtils::MemSpec
 
 #endif /* DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECLPDDR4_H */
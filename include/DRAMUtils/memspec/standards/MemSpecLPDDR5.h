@@ -36,12 +36,18 @@
 #ifndef DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECLPDDR5_H
 #define DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECLPDDR5_H
 
+#include <array>
 #include <string_view>
 #include <string>
 #include <optional>
 
 #include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/memspec/ActivateWindow.h"
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/EnergyTable.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingChecker.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -62,6 +68,7 @@ struct MemArchitectureSpecTypeLPDDR5
     std::optional<uint64_t> maxBurstLength;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeLPDDR5, nbrOfDevices, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, per2BankOffset, WCKalwaysOn, maxBurstLength)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeLPDDR5, MemArchitectureSpecTypeLPDDR5, uint32_t, nbrOfDevices, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfBankGroups, nbrOfRows, nbrOfColumns, burstLength, dataRate, width, per2BankOffset, WCKalwaysOn, maxBurstLength)
 
 struct MemImpedanceSpecTypeLPDDR5
 {
@@ -119,6 +126,8 @@ struct MemTimingSpecTypeLPDDR5
     uint64_t    pbR2pbR;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeLPDDR5, tCK, REFI, REFIpb, RFCab, RFCpb, RAS, RPab, RPpb, RCpb, RCab, PPD, RCD_L, RCD_S, FAW, RRD, RL, RBTP, WL, WR, RTRS, BL_n_min_16, BL_n_max_16, BL_n_L_16, BL_n_S_16, BL_n_min_32, BL_n_max_32, BL_n_L_32, BL_n_S_32, WTR_L, WTR_S, WCK2DQO, WCK2CK, pbR2act, pbR2pbR)
+DRAMUTILS_DECLARE_TIMING_TABLE(LPDDR5, MemTimingSpecTypeLPDDR5, REFI, REFIpb, RFCab, RFCpb, RAS, RPab, RPpb, RCpb, RCab, PPD, RCD_L, RCD_S, FAW, RRD, RL, RBTP, WL, WR, RTRS, BL_n_min_16, BL_n_max_16, BL_n_L_16, BL_n_S_16, BL_n_min_32, BL_n_max_32, BL_n_L_32, BL_n_S_32, WTR_L, WTR_S, WCK2DQO, WCK2CK, pbR2act, pbR2pbR)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeLPDDR5, MemTimingSpecTypeLPDDR5, uint16_t, tCK, REFI, REFIpb, RFCab, RFCpb, RAS, RPab, RPpb, RCpb, RCab, PPD, RCD_L, RCD_S, FAW, RRD, RL, RBTP, WL, WR, RTRS, BL_n_min_16, BL_n_max_16, BL_n_L_16, BL_n_S_16, BL_n_min_32, BL_n_max_32, BL_n_L_32, BL_n_S_32, WTR_L, WTR_S, WCK2DQO, WCK2CK, pbR2act, pbR2pbR)
 
 struct BankWiseSpecTypeLPDDR5
 {
@@ -178,7 +187,7 @@ NLOHMANN_JSONIFY_ALL_THINGS(MemPowerSpecTypeLPDDR5, vdd1, idd01, idd2n1, idd3n1,
 struct MemSpecLPDDR5 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "LPDDR5";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeLPDDR5 memarchitecturespec;
     MemPowerSpecTypeLPDDR5 mempowerspec;
@@ -188,6 +197,48 @@ struct MemSpecLPDDR5 : BaseMemSpec
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemSpecLPDDR5, memoryId, memarchitecturespec, mempowerspec, memtimingspec, bankwisespec, memimpedancespec)
 
+// Energy table of a single device, PRE is the per bank precharge
+inline EnergyTable make_energy_table(const MemSpecLPDDR5& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& p = memspec.mempowerspec;
+    const auto& t = memspec.memtimingspec;
+
+    const std::array<detail::EnergyRail, 3> rails{{
+        {p.vdd1, p.idd01, p.idd2n1, p.idd3n1, p.idd4r1, p.idd4w1, p.idd51, p.idd5pb1, p.idd2p1, p.idd3p1, p.idd61},
+        {p.vdd2h, p.idd02h, p.idd2n2h, p.idd3n2h, p.idd4r2h, p.idd4w2h, p.idd52h, p.idd5pb2h, p.idd2p2h, p.idd3p2h, p.idd62h},
+        {p.vdd2l, p.idd02l, p.idd2n2l, p.idd3n2l, p.idd4r2l, p.idd4w2l, p.idd52l, p.idd5pb2l, p.idd2p2l, p.idd3p2l, p.idd62l},
+    }};
+    return detail::make_energy_table(rails, {t.tCK, t.RAS, t.RPpb, t.RFCab, t.RFCpb, detail::burst_cycles(arch.burstLength, arch.dataRate)});
+}
+
+// Constraints of a single rank, precharges and REFPB use the per bank timings.
+// Burst timings are selected by the burst length (16 or 32).
+inline ConstraintMatrix make_constraint_matrix(const MemSpecLPDDR5& memspec) noexcept
+{
+    const auto& arch = memspec.memarchitecturespec;
+    const auto& t = memspec.memtimingspec;
+
+    const bool bl32 = arch.burstLength == 32;
+    const uint64_t burst = bl32 ? t.BL_n_min_32 : t.BL_n_min_16;
+    const uint64_t CCD_L = bl32 ? t.BL_n_L_32 : t.BL_n_L_16;
+    const uint64_t CCD_S = bl32 ? t.BL_n_S_32 : t.BL_n_S_16;
+    return detail::make_constraint_matrix({t.RCD_L, t.RCD_S, t.RPpb, t.RAS, t.RCpb, t.RL, t.WL, burst, burst + t.RBTP, t.WR,
+        CCD_L, CCD_S, CCD_L, t.RRD, t.RRD, t.FAW, t.WTR_L, t.WTR_S, t.RTRS, t.RFCab, t.RFCpb, t.pbR2act, t.pbR2pbR});
+}
+
+inline TimingChecker make_timing_checker(const MemSpecLPDDR5& memspec)
+{
+    const auto& arch = memspec.memarchitecturespec;
+    return detail::make_timing_checker(make_constraint_matrix(memspec), arch.nbrOfRanks, arch.nbrOfBankGroups, arch.nbrOfBanks);
+}
+
+// Activate window of one rank
+inline ActivateWindow<> make_activate_window(const MemSpecLPDDR5& memspec) noexcept
+{
+    return ActivateWindow<>(memspec.memtimingspec.FAW);
+}
+
 } // namespace DRAMUtils::MemSpec
 
 #endif /* DRAMUTILS_MEMSPEC_STANDARDS_MEMSPECLPDDR5_H */
@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -58,6 +60,7 @@ struct MemArchitectureSpecTypeSTTMRAM
     uint64_t nbrOfBanks;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeSTTMRAM, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfRanks, nbrOfDevices, nbrOfBanks)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeSTTMRAM, MemArchitectureSpecTypeSTTMRAM, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfRanks, nbrOfDevices, nbrOfBanks)
 
 struct MemTimingSpecTypeSTTMRAM
 {
@@ -87,11 +90,13 @@ struct MemTimingSpecTypeSTTMRAM
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeSTTMRAM, tCK, CKE, CKESR, RAS, RC, RCD, RL, RTP, WL, WR, XP, XS, RP, DQSCK, CCD, FAW, RRD, WTR, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(STTMRAM, MemTimingSpecTypeSTTMRAM, CKE, CKESR, RAS, RC, RCD, RL, RTP, WL, WR, XP, XS, RP, DQSCK, CCD, FAW, RRD, WTR, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeSTTMRAM, MemTimingSpecTypeSTTMRAM, uint16_t, tCK, CKE, CKESR, RAS, RC, RCD, RL, RTP, WL, WR, XP, XS, RP, DQSCK, CCD, FAW, RRD, WTR, XPDLL, XSDLL, AL, ACTPDEN, PRPDEN, RTRS)
 
 struct MemSpecSTTMRAM : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "STT-MRAM";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeSTTMRAM memarchitecturespec;
     MemTimingSpecTypeSTTMRAM memtimingspec;
@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -58,6 +60,7 @@ struct MemArchitectureSpecTypeWideIO
     uint64_t nbrOfDevices;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeWideIO, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfDevices)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeWideIO, MemArchitectureSpecTypeWideIO, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfRanks, nbrOfBanks, nbrOfDevices)
 
 struct MemTimingSpecTypeWideIO
 {
@@ -85,11 +88,13 @@ struct MemTimingSpecTypeWideIO
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeWideIO, tCK, CKE, CKESR, RAS, RC, RCD, RL, WL, WR, XP, XSR, REFI, RFC, RP, DQSCK, AC, CCD_R, CCD_W, RRD, TAW, WTR, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(WideIO, MemTimingSpecTypeWideIO, CKE, CKESR, RAS, RC, RCD, RL, WL, WR, XP, XSR, REFI, RFC, RP, DQSCK, AC, CCD_R, CCD_W, RRD, TAW, WTR, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeWideIO, MemTimingSpecTypeWideIO, uint16_t, tCK, CKE, CKESR, RAS, RC, RCD, RL, WL, WR, XP, XSR, REFI, RFC, RP, DQSCK, AC, CCD_R, CCD_W, RRD, TAW, WTR, RTRS)
 
 struct MemSpecWideIO : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "WIDEIO_SDR";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeWideIO memarchitecturespec;
     MemTimingSpecTypeWideIO memtimingspec;
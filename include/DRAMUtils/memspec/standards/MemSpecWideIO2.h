@@ -41,6 +41,8 @@
 #include "DRAMUtils/util/json_utils.h"
 
 #include "DRAMUtils/memspec/BaseMemSpec.h"
+#include "DRAMUtils/memspec/PackedSpec.h"
+#include "DRAMUtils/memspec/TimingTable.h"
 
 namespace DRAMUtils::MemSpec {
 
@@ -58,6 +60,7 @@ struct MemArchitectureSpecTypeWideIO2
     uint64_t nbrOfBanks;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemArchitectureSpecTypeWideIO2, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfRanks, nbrOfDevices, nbrOfBanks)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemArchitectureSpecTypeWideIO2, MemArchitectureSpecTypeWideIO2, uint32_t, nbrOfRows, nbrOfColumns, burstLength, maxBurstLength, dataRate, width, nbrOfChannels, nbrOfRanks, nbrOfDevices, nbrOfBanks)
 
 struct MemTimingSpecTypeWideIO2
 {
@@ -90,11 +93,13 @@ struct MemTimingSpecTypeWideIO2
     uint64_t    RTRS;
 };
 NLOHMANN_JSONIFY_ALL_THINGS(MemTimingSpecTypeWideIO2, tCK, DQSCK, DQSS, CKE, RL, WL, RCPB, RCAB, CKESR, XSR, XP, CCD, RTP, RCD, RPPB, RPAB, RAS, WR, WTR, RRD, FAW, REFI, REFM, REFIPB, RFCAB, RFCPB, RTRS)
+DRAMUTILS_DECLARE_TIMING_TABLE(WideIO2, MemTimingSpecTypeWideIO2, DQSCK, DQSS, CKE, RL, WL, RCPB, RCAB, CKESR, XSR, XP, CCD, RTP, RCD, RPPB, RPAB, RAS, WR, WTR, RRD, FAW, REFI, REFM, REFIPB, RFCAB, RFCPB, RTRS)
+DRAMUTILS_DECLARE_PACKED_SPEC(PackedMemTimingSpecTypeWideIO2, MemTimingSpecTypeWideIO2, uint16_t, tCK, DQSCK, DQSS, CKE, RL, WL, RCPB, RCAB, CKESR, XSR, XP, CCD, RTP, RCD, RPPB, RPAB, RAS, WR, WTR, RRD, FAW, REFI, REFM, REFIPB, RFCAB, RFCPB, RTRS)
 
 struct MemSpecWideIO2 : BaseMemSpec
 {
     static constexpr inline const std::string_view id = "WIDEIO2";
-    std::string memoryId;
+    MemoryId memoryId;
 
     MemArchitectureSpecTypeWideIO2 memarchitecturespec;
     MemTimingSpecTypeWideIO2 memtimingspec;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+
+#ifndef DRAMUTILS_UTIL_ATOMIC_SHARED_PTR_H
+#define DRAMUTILS_UTIL_ATOMIC_SHARED_PTR_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace DRAMUtils::util
+{
+
+/**
+ * @brief std::shared_ptr that is loaded and replaced atomically.
+ *        Uses std::atomic<std::shared_ptr<T>> if the standard library provides it (C++20) and
+ *        the std::atomic_load/std::atomic_store overloads for std::shared_ptr otherwise, which
+ *        are deprecated in C++20.
+ *        Neither is guaranteed to be lock free, libstdc++ takes an internal lock that is only
+ *        held while the pointer is copied.
+ */
+template <typename T>
+class AtomicSharedPtr
+{
+public:
+    AtomicSharedPtr() = default;
+    explicit AtomicSharedPtr(std::shared_ptr<T> value) noexcept : value_(std::move(value)) {}
+
+    AtomicSharedPtr(const AtomicSharedPtr&) = delete;
+    AtomicSharedPtr& operator=(const AtomicSharedPtr&) = delete;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::shared_ptr<T> load() const noexcept { return value_.load(std::memory_order_acquire); }
+
+    void store(std::shared_ptr<T> value) noexcept
+    {
+        value_.store(std::move(value), std::memory_order_release);
+    }
+
+private:
+    std::atomic<std::shared_ptr<T>> value_;
+#else
+    std::shared_ptr<T> load() const noexcept
+    {
+        return std::atomic_load_explicit(&value_, std::memory_order_acquire);
+    }
+
+    void store(std::shared_ptr<T> value) noexcept
+    {
+        std::atomic_store_explicit(&value_, std::move(value), std::memory_order_release);
+    }
+
+private:
+    std::shared_ptr<T> value_;
+#endif
+};
+
+} // namespace DRAMUtils::util
+
+#endif /* DRAMUTILS_UTIL_ATOMIC_SHARED_PTR_H */
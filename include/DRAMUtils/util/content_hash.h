@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+
+#ifndef DRAMUTILS_UTIL_CONTENT_HASH_H
+#define DRAMUTILS_UTIL_CONTENT_HASH_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "fixed_string.h"
+#include "id_variant.h"
+#include "json_utils.h"
+
+namespace DRAMUtils::util
+{
+
+/**
+ * @brief Streaming 64 bit hash of 64 bit words, the XXH64 lane round and avalanche applied to
+ *        a word stream. The result only depends on the words, not on the platform.
+ */
+class ContentHasher
+{
+public:
+    explicit constexpr ContentHasher(std::uint64_t seed = 0) noexcept
+        : state_(seed + prime5)
+    {}
+
+    constexpr void word(std::uint64_t value) noexcept
+    {
+        state_ ^= lane(value);
+        state_ = rotl(state_, 27) * prime1 + prime4;
+        ++words_;
+    }
+
+    // Length followed by the bytes packed little endian into words
+    constexpr void bytes(std::string_view data) noexcept
+    {
+        word(data.size());
+        std::uint64_t packed = 0;
+        std::size_t shift = 0;
+        for (const char c : data)
+        {
+            packed |= static_cast<std::uint64_t>(static_cast<unsigned char>(c)) << shift;
+            shift += 8;
+            if (shift == 64)
+            {
+                word(packed);
+                packed = 0;
+                shift = 0;
+            }
+        }
+        if (shift != 0)
+            word(packed);
+    }
+
+    // 0.0 and -0.0 hash equally, as they compare equal, and all NaNs share one hash
+    void real(double value) noexcept
+    {
+        if (value == 0.0)
+            value = 0.0;
+        else if (std::isnan(value))
+            value = std::numeric_limits<double>::quiet_NaN();
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        word(bits);
+    }
+
+    /**
+     * @brief Hashes a value by a canonical walk over its content: the fields listed in
+     *        NLOHMANN_JSONIFY_ALL_THINGS in order, the id of the active IdVariant alternative,
+     *        the presence of optionals and the size of strings and sequences.
+     *        Field names are not hashed, values equal by operator== hash equally.
+     */
+    template <typename T>
+    void value(const T& v)
+    {
+        if constexpr (is_optional<T>)
+        {
+            word(v.has_value());
+            if (v)
+                value(*v);
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            word(v ? 1 : 0);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            word(static_cast<std::uint64_t>(v));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            word(static_cast<std::uint64_t>(v));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            real(static_cast<double>(v));
+        }
+        else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>)
+        {
+            bytes(v);
+        }
+        else if constexpr (is_fixed_string<T>)
+        {
+            bytes(v.view());
+        }
+        else if constexpr (is_id_variant<T>)
+        {
+            // The id instead of the index keeps the hash stable if the alternatives are reordered
+            std::visit([this](const auto& alternative) {
+                bytes(std::decay_t<decltype(alternative)>::id);
+                value(alternative);
+            }, v.getVariant());
+        }
+        else if constexpr (is_variant<T>)
+        {
+            word(v.index());
+            std::visit([this](const auto& alternative) { value(alternative); }, v);
+        }
+        else if constexpr (detail::is_sequence<T>)
+        {
+            word(v.size());
+            for (const auto& element : v)
+                value(element);
+        }
+        else if constexpr (has_json_fields<T>::value)
+        {
+            for_each_field(v, [this](auto, const auto& field) { value(field); });
+        }
+        else
+        {
+            static_assert(always_false<T>::value, "Type is not supported by the content hash.");
+        }
+    }
+
+    constexpr std::uint64_t digest() const noexcept
+    {
+        std::uint64_t hash = state_ + words_ * 8;
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        hash *= prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+private:
+    static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr std::uint64_t prime3 = 0x165667B19E3779F9ull;
+    static constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+    static constexpr std::uint64_t rotl(std::uint64_t x, int r) noexcept
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static constexpr std::uint64_t lane(std::uint64_t input) noexcept
+    {
+        return rotl(input * prime2, 31) * prime1;
+    }
+
+    std::uint64_t state_;
+    std::uint64_t words_ = 0;
+};
+
+// Stable 64 bit hash of the content of v, see ContentHasher::value
+template <typename T>
+std::uint64_t content_hash(const T& v, std::uint64_t seed = 0)
+{
+    ContentHasher hasher(seed);
+    hasher.value(v);
+    return hasher.digest();
+}
+
+// Hash functor for unordered containers keyed by MemSpecs or their sub-structs
+struct ContentHash
+{
+    template <typename T>
+    std::size_t operator()(const T& v) const
+    {
+        return static_cast<std::size_t>(content_hash(v));
+    }
+};
+
+} // namespace DRAMUtils::util
+
+namespace std
+{
+
+template <char const * id_field_name, typename Seq>
+struct hash<DRAMUtils::util::IdVariant<id_field_name, Seq>> : DRAMUtils::util::ContentHash {};
+
+} // namespace std
+
+#endif /* DRAMUTILS_UTIL_CONTENT_HASH_H */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_UTIL_EXPECTED_H
+#define DRAMUTILS_UTIL_EXPECTED_H
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace DRAMUtils::util
+{
+
+// Wrapper to construct an Expected holding an error
+template <typename E>
+struct Unexpected
+{
+    E error;
+};
+
+template <typename E>
+Unexpected<std::decay_t<E>> unexpected(E&& error)
+{
+    return {std::forward<E>(error)};
+}
+
+/**
+ * @brief Minimal C++17 stand-in for std::expected: holds either a value of type T or an error
+ *        of type E. Accessing the value of an error result throws std::bad_variant_access.
+ */
+template <typename T, typename E>
+class Expected
+{
+public:
+    using value_type = T;
+    using error_type = E;
+
+    Expected(const T& value) : storage(std::in_place_index<0>, value) {}
+    Expected(T&& value) : storage(std::in_place_index<0>, std::move(value)) {}
+    Expected(Unexpected<E> error) : storage(std::in_place_index<1>, std::move(error.error)) {}
+
+    bool has_value() const noexcept { return storage.index() == 0; }
+    explicit operator bool() const noexcept { return has_value(); }
+
+    T& value() & { return std::get<0>(storage); }
+    const T& value() const & { return std::get<0>(storage); }
+    T&& value() && { return std::get<0>(std::move(storage)); }
+
+    T& operator*() & { return *std::get_if<0>(&storage); }
+    const T& operator*() const & { return *std::get_if<0>(&storage); }
+    T* operator->() { return std::get_if<0>(&storage); }
+    const T* operator->() const { return std::get_if<0>(&storage); }
+
+    E& error() & { return std::get<1>(storage); }
+    const E& error() const & { return std::get<1>(storage); }
+
+private:
+    std::variant<T, E> storage;
+};
+
+} // namespace DRAMUtils::util
+
+#endif /* DRAMUTILS_UTIL_EXPECTED_H */
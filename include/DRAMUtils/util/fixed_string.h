@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_UTIL_FIXED_STRING_H
+#define DRAMUTILS_UTIL_FIXED_STRING_H
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "json.h"
+
+namespace DRAMUtils::util
+{
+
+/**
+ * @brief String with a fixed capacity and no heap storage. Unlike std::string it is a literal
+ *        type, so structs holding it can be constexpr.
+ */
+template <std::size_t Capacity>
+class FixedString
+{
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    constexpr FixedString() noexcept = default;
+
+    // Throws std::length_error if str exceeds the capacity
+    constexpr explicit FixedString(std::string_view str)
+    {
+        if (!assign(str))
+            throw std::length_error("FixedString capacity exceeded");
+    }
+
+    constexpr FixedString& operator=(std::string_view str)
+    {
+        if (!assign(str))
+            throw std::length_error("FixedString capacity exceeded");
+        return *this;
+    }
+
+    // Returns false and leaves the string unchanged if str exceeds the capacity
+    constexpr bool assign(std::string_view str) noexcept
+    {
+        if (str.size() > Capacity)
+            return false;
+        for (std::size_t i = 0; i < Capacity; ++i)
+            data_[i] = i < str.size() ? str[i] : '\0';
+        size_ = str.size();
+        return true;
+    }
+
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr const char* data() const noexcept { return data_; }
+    constexpr const char* c_str() const noexcept { return data_; }
+
+    constexpr std::string_view view() const noexcept { return {data_, size_}; }
+    constexpr operator std::string_view() const noexcept { return view(); }
+    std::string str() const { return std::string(view()); }
+
+    friend constexpr bool operator==(const FixedString& lhs, const FixedString& rhs) noexcept {
+        return lhs.view() == rhs.view();
+    }
+    friend constexpr bool operator==(const FixedString& lhs, std::string_view rhs) noexcept {
+        return lhs.view() == rhs;
+    }
+    friend constexpr bool operator==(std::string_view lhs, const FixedString& rhs) noexcept {
+        return lhs == rhs.view();
+    }
+    friend constexpr bool operator!=(const FixedString& lhs, const FixedString& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+    friend constexpr bool operator!=(const FixedString& lhs, std::string_view rhs) noexcept {
+        return !(lhs == rhs);
+    }
+    friend constexpr bool operator!=(std::string_view lhs, const FixedString& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const FixedString& str) {
+        return os << str.view();
+    }
+
+private:
+    char data_[Capacity + 1]{};
+    std::size_t size_ = 0;
+};
+
+template <typename>
+constexpr bool is_fixed_string = false;
+template <std::size_t Capacity>
+constexpr bool is_fixed_string<FixedString<Capacity>> = true;
+
+#ifndef DRAMUTILS_DECLARE_ONLY
+
+template <std::size_t Capacity>
+void to_json(json_t& j, const FixedString<Capacity>& str)
+{
+    j = str.view();
+}
+
+template <std::size_t Capacity>
+void from_json(const json_t& j, FixedString<Capacity>& str)
+{
+    str = j.get_ref<const json_t::string_t&>();
+}
+
+#endif /* DRAMUTILS_DECLARE_ONLY */
+
+} // namespace DRAMUtils::util
+
+#endif /* DRAMUTILS_UTIL_FIXED_STRING_H */
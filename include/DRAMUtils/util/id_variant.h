@@ -36,10 +36,15 @@
 #ifndef DRAMUTILS_UTIL_ID_VARIANT_H
 #define DRAMUTILS_UTIL_ID_VARIANT_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <variant>
 #include <string_view>
 #include <utility>
 
+#include "hash.h"
 #include "json.h"
 #include "types.h"
 
@@ -52,6 +57,69 @@ using VariantName = DRAMUtils::util::IdVariant<detail::id_field_name_##VariantNa
 namespace DRAMUtils::util
 {
 
+namespace detail
+{
+
+// FNV-1a hash of an id
+constexpr std::uint64_t id_hash(std::string_view id) noexcept
+{
+    return fnv1a(id);
+}
+
+// Smallest modulus for which id_hash(id) % modulus is unique for all ids, 0 if none was found
+template <std::size_t N>
+constexpr std::size_t id_hash_modulus(const std::array<std::string_view, N>& ids) noexcept
+{
+    for (std::size_t modulus = N > 0 ? N : 1; modulus <= 16 * N; ++modulus)
+    {
+        bool unique = true;
+        for (std::size_t i = 0; i < N && unique; ++i)
+        {
+            for (std::size_t j = 0; j < i && unique; ++j)
+                unique = id_hash(ids[i]) % modulus != id_hash(ids[j]) % modulus;
+        }
+        if (unique)
+            return modulus;
+    }
+    return 0;
+}
+
+// Slot table of the perfect hash, empty slots hold N
+template <std::size_t Modulus, std::size_t N>
+constexpr std::array<std::size_t, Modulus> id_hash_slots(const std::array<std::string_view, N>& ids) noexcept
+{
+    std::array<std::size_t, Modulus> slots{};
+    for (auto& slot : slots)
+        slot = N;
+    for (std::size_t i = 0; i < N; ++i)
+        slots[id_hash(ids[i]) % Modulus] = i;
+    return slots;
+}
+
+// Compile time perfect hash table mapping the ids of Ts to their index in Ts
+template <typename... Ts>
+class IdTable
+{
+public:
+    static constexpr std::size_t size = sizeof...(Ts);
+
+    // Index of the type with the given id or size if the id is unknown
+    static constexpr std::size_t find(std::string_view id) noexcept
+    {
+        const std::size_t index = slots[id_hash(id) % modulus];
+        return index < size && ids[index] == id ? index : size;
+    }
+
+private:
+    static constexpr std::array<std::string_view, size> ids{Ts::id...};
+    static constexpr std::size_t modulus = id_hash_modulus(ids);
+    static_assert(modulus != 0, "No perfect hash found for the ids of the IdVariant types.");
+
+    static constexpr std::array<std::size_t, modulus> slots = id_hash_slots<modulus>(ids);
+};
+
+} // namespace detail
+
 template <char const * id_field_name, typename Seq>
 class IdVariant
 {
@@ -76,15 +144,41 @@ private:
     Variant variant;
 
 private:
-    template <typename Seq>
-    bool variant_from_json(const json_t& j, util::type_sequence_id_variant_t<Seq>& data) {
-        return variant_from_json_impl(j, data, Seq{}); // Seq{} needed for type deduction
+    using Ids = detail::IdTable<Ts...>;
+
+    // Calls f with the index of the active alternative as integral constant
+    template <typename F, std::size_t... Is>
+    static bool dispatch(std::size_t index, F&& f, std::index_sequence<Is...>) {
+        return ((index == Is && f(std::integral_constant<std::size_t, Is>{})) || ...);
     }
 
-    template <typename... Types>
-    bool variant_from_json_impl(const json_t& j, util::type_sequence_id_variant_t<util::type_sequence<Types...>>& data, util::type_sequence<Types...>) {
-        const std::string& key = j.at(id_field_name_);
-        return (( key == Types::id && (data = j.get<Types>(), true)) || ...);
+    bool variant_from_json(const json_t& j);
+
+public:
+    static constexpr std::size_t size = sizeof...(Ts);
+
+    // Name of the json field holding the id of the alternative
+    static constexpr std::string_view idFieldName() noexcept { return id_field_name; }
+
+    // Index of the alternative with the given id or std::nullopt if the id is unknown
+    static std::optional<std::size_t> findIndex(std::string_view id) noexcept {
+        const std::size_t index = Ids::find(id);
+        if (index == size)
+            return std::nullopt;
+        return index;
+    }
+
+    /**
+     * @brief Emplaces the value initialized alternative with the given index and passes it to
+     *        fill, which returns false if the alternative could not be filled.
+     * 
+     * @return false if the index is out of range or fill failed, true otherwise.
+     */
+    template <typename F>
+    bool emplace(std::size_t index, F&& fill) {
+        return dispatch(index, [this, &fill](auto I) {
+            return fill(variant.template emplace<decltype(I)::value>());
+        }, std::index_sequence_for<Ts...>{});
     }
 
 public:
@@ -103,20 +197,54 @@ public:
         return variant;
     }
 
-public:
-    void to_json(json_t& j) const {
-        std::visit(
-            [&j](const auto& v) {
-                j = v;
-                j[id_field_name] = v.id;
-            },
-        variant);
+    // Equal if the same alternative is active and its fields are equal
+    friend bool operator==(const IdVariant& lhs, const IdVariant& rhs) {
+        return lhs.variant == rhs.variant;
     }
-    bool from_json(const json_t& j) {
-        return variant_from_json<VariantTypes>(j, variant);
+
+    friend bool operator!=(const IdVariant& lhs, const IdVariant& rhs) {
+        return !(lhs == rhs);
     }
+
+public:
+    void to_json(json_t& j) const;
+    // Returns false if the id field is missing or unknown. Invalid alternatives throw.
+    bool from_json(const json_t& j);
 };
 
+// The json conversions are compiled into the library in DRAMUTILS_COMPILED mode
+#ifndef DRAMUTILS_DECLARE_ONLY
+
+template<char const * id_field_name, typename... Ts>
+bool IdVariant<id_field_name, util::type_sequence<Ts...>>::variant_from_json(const json_t& j) {
+    const auto it = j.find(id_field_name_);
+    if (it == j.end() || !it->is_string())
+        return false;
+
+    const auto index = findIndex(it->template get_ref<const std::string&>());
+    return index && emplace(*index, [&j](auto& data) {
+        j.get_to(data);
+        return true;
+    });
+}
+
+template<char const * id_field_name, typename... Ts>
+void IdVariant<id_field_name, util::type_sequence<Ts...>>::to_json(json_t& j) const {
+    std::visit(
+        [&j](const auto& v) {
+            j = v;
+            j[id_field_name] = v.id;
+        },
+    variant);
+}
+
+template<char const * id_field_name, typename... Ts>
+bool IdVariant<id_field_name, util::type_sequence<Ts...>>::from_json(const json_t& j) {
+    return variant_from_json(j);
+}
+
+#endif /* DRAMUTILS_DECLARE_ONLY */
+
 } // namespace DRAMUtils::util
 
 
@@ -36,7 +36,13 @@
 #ifndef DRAMUTILS_UTIL_JSON_H
 #define DRAMUTILS_UTIL_JSON_H
 
+#include "macros.h"
+
+#ifdef DRAMUTILS_DECLARE_ONLY
+#include "nlohmann/json_fwd.hpp"
+#else
 #include "nlohmann/json.hpp"
+#endif
 
 using json_t = nlohmann::json;
 
@@ -0,0 +1,1148 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_UTIL_JSON_SAX_H
+#define DRAMUTILS_UTIL_JSON_SAX_H
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "json.h"
+#include "fixed_string.h"
+#include "json_utils.h"
+#include "id_variant.h"
+#include "parse_status.h"
+#include "types.h"
+
+namespace DRAMUtils::util::sax
+{
+
+/*
+ * SAX based deserialization into the structs declared with NLOHMANN_JSONIFY_ALL_THINGS.
+ * The events of json_t::sax_parse are written directly into the target fields, no
+ * intermediate json_t is built. Types without generated field visitors (enums, variants, ...)
+ * are captured into a small json_t and converted with their regular from_json.
+ */
+
+class Frame;
+
+// Type erased reference to the value receiving the next SAX event
+struct Target
+{
+    struct Ops
+    {
+        bool (*null)(void*);
+        bool (*boolean)(void*, bool);
+        bool (*number_integer)(void*, json_t::number_integer_t);
+        bool (*number_unsigned)(void*, json_t::number_unsigned_t);
+        bool (*number_float)(void*, json_t::number_float_t);
+        bool (*string)(void*, json_t::string_t&);
+        std::unique_ptr<Frame> (*start_object)(void*);
+        bool (*from_json)(void*, const json_t&);
+        bool capture; // objects and arrays are collected into a json_t first
+        const char* expected; // json type of the value, used for error reports
+    };
+
+    void* object = nullptr;
+    const Ops* ops = nullptr; // nullptr: the value is skipped
+};
+
+template <typename T>
+struct TargetOps;
+
+template <typename T>
+Target make_target(T& value);
+
+// An object currently being parsed
+class Frame
+{
+public:
+    virtual ~Frame() = default;
+
+    virtual bool key(const json_t::string_t& name) = 0;
+    virtual Target next() const = 0;
+    virtual bool end() = 0;
+
+    // Key of the current value, used for error reports
+    virtual std::string_view currentKey() const = 0;
+    // Name and expected type of the member that made end() fail, used for error reports
+    virtual std::pair<std::string_view, const char*> missing() const = 0;
+};
+
+namespace detail
+{
+
+// Structs parsed field by field. Structs with std::variant fields are captured instead, their
+// variants are read from the enclosing object.
+template <typename T>
+struct has_json_fields : std::bool_constant<util::has_json_fields<T>::value && !util::has_variant_field<T>> {};
+
+// Maximum number of fields in a single struct tracked for completeness
+constexpr std::size_t max_fields = 128;
+
+} // namespace detail
+
+// Fields of a struct declared with NLOHMANN_JSONIFY_ALL_THINGS, built once per type from its
+// member pointers
+template <typename T>
+class FieldTable
+{
+public:
+    struct Field
+    {
+        std::string_view name;
+        void* (*member)(T&);
+        const Target::Ops* ops;
+        std::size_t index;
+        bool required;
+    };
+
+    static const FieldTable& get()
+    {
+        static const FieldTable table;
+        return table;
+    }
+
+    // Fields sorted by name
+    const std::vector<Field>& fields() const { return byName; }
+
+    const Field* find(std::string_view name, std::size_t& cursor) const
+    {
+        // Serialized objects are usually sorted by name, so the successor of the last match
+        // is checked before falling back to a binary search
+        if (cursor < byName.size() && byName[cursor].name == name)
+            return &byName[cursor++];
+
+        const auto it = std::lower_bound(byName.begin(), byName.end(), name,
+                                         [](const Field& field, std::string_view value) {
+                                             return field.name < value;
+                                         });
+        if (it == byName.end() || it->name != name)
+            return nullptr;
+        cursor = static_cast<std::size_t>(it - byName.begin()) + 1;
+        return &*it;
+    }
+
+    // False if the struct has more fields than can be tracked
+    bool valid() const { return byName.size() <= detail::max_fields; }
+
+private:
+    FieldTable() : FieldTable(std::make_index_sequence<util::field_count<T>>{}) {}
+
+    template <std::size_t... Is>
+    explicit FieldTable(std::index_sequence<Is...>)
+        : byName{Field{util::field_names<T>[Is], &member<Is>, &TargetOps<util::field_type<T, Is>>::value,
+                       Is, !util::is_optional<util::field_type<T, Is>>}...}
+    {
+        std::sort(byName.begin(), byName.end(), [](const Field& lhs, const Field& rhs) {
+            return lhs.name < rhs.name;
+        });
+    }
+
+    // Address of the I-th field of object
+    template <std::size_t I>
+    static void* member(T& object)
+    {
+        constexpr auto pointers = json_field_pointers(util::field_tag<T>{});
+        return &(object.*std::get<I>(pointers));
+    }
+
+    std::vector<Field> byName;
+};
+
+// Object with fields declared by NLOHMANN_JSONIFY_ALL_THINGS
+template <typename T>
+class StructFrame final : public Frame
+{
+public:
+    explicit StructFrame(T& object) : object(object) {}
+
+    bool key(const json_t::string_t& name) override
+    {
+        field = table.find(name, cursor);
+        if (!field)
+        {
+            target = Target{};
+            return true;
+        }
+        target = Target{field->member(object), field->ops};
+        seen.set(field->index);
+        return true;
+    }
+
+    Target next() const override { return target; }
+
+    std::string_view currentKey() const override { return field ? field->name : std::string_view{}; }
+
+    std::pair<std::string_view, const char*> missing() const override
+    {
+        for (const auto& required : table.fields())
+        {
+            if (required.required && !seen.test(required.index))
+                return {required.name, required.ops->expected};
+        }
+        return {{}, "object with at most 128 fields"};
+    }
+
+    bool end() override
+    {
+        // Same semantics as extended_from_json: every non optional field is required
+        if (!table.valid())
+            return false;
+        for (const auto& field : table.fields())
+        {
+            if (field.required && !seen.test(field.index))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    T& object;
+    const FieldTable<T>& table = FieldTable<T>::get();
+    std::size_t cursor = 0;
+    const typename FieldTable<T>::Field* field = nullptr;
+    Target target;
+    std::bitset<detail::max_fields> seen;
+};
+
+// Object of which only the member with the given key is parsed
+struct KeySelector
+{
+    std::string_view key;
+    Target target;
+};
+
+class SelectFrame final : public Frame
+{
+public:
+    explicit SelectFrame(const KeySelector& selector) : selector(selector) {}
+
+    bool key(const json_t::string_t& name) override
+    {
+        selected = name == selector.key;
+        found = found || selected;
+        return true;
+    }
+
+    Target next() const override { return selected ? selector.target : Target{}; }
+
+    bool end() override { return found; }
+
+    std::string_view currentKey() const override { return selector.key; }
+
+    std::pair<std::string_view, const char*> missing() const override
+    {
+        return {selector.key, selector.target.ops->expected};
+    }
+
+private:
+    const KeySelector& selector;
+    bool selected = false;
+    bool found = false;
+};
+
+// Conversion of SAX events into a value of type T
+template <typename T>
+struct Slot
+{
+    template <typename V>
+    static bool assign(T& target, V&& value)
+    {
+        using Value = std::decay_t<V>;
+        if constexpr (util::is_optional<T>)
+        {
+            return Slot<typename T::value_type>::assign(target.emplace(), std::forward<V>(value));
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            if constexpr (std::is_same_v<Value, bool>)
+            {
+                target = value;
+                return true;
+            }
+            return false;
+        }
+        else if constexpr (std::is_arithmetic_v<T>)
+        {
+            // Matches nlohmann: numbers and booleans convert to any arithmetic type
+            if constexpr (std::is_arithmetic_v<Value>)
+            {
+                target = static_cast<T>(value);
+                return true;
+            }
+            return false;
+        }
+        else if constexpr (std::is_same_v<T, json_t::string_t>)
+        {
+            if constexpr (std::is_same_v<Value, json_t::string_t>)
+            {
+                target = std::forward<V>(value);
+                return true;
+            }
+            return false;
+        }
+        else if constexpr (util::is_fixed_string<T>)
+        {
+            if constexpr (std::is_same_v<Value, json_t::string_t>)
+                return target.assign(value);
+            return false;
+        }
+        else if constexpr (detail::has_json_fields<T>::value)
+        {
+            return false;
+        }
+        else
+        {
+            return from_json(target, json_t(std::forward<V>(value)));
+        }
+    }
+
+    static std::unique_ptr<Frame> start_object(T& target)
+    {
+        if constexpr (util::is_optional<T>)
+            return Slot<typename T::value_type>::start_object(target.emplace());
+        else if constexpr (detail::has_json_fields<T>::value)
+            return std::make_unique<StructFrame<T>>(target);
+        else
+            return nullptr;
+    }
+
+    static bool from_json(T& target, const json_t& j)
+    {
+        if constexpr (util::is_optional<T>)
+        {
+            return Slot<typename T::value_type>::from_json(target.emplace(), j);
+        }
+        else
+        {
+            try
+            {
+                j.get_to(target);
+                return true;
+            }
+            catch (std::exception&)
+            {
+                return false;
+            }
+        }
+    }
+
+    static constexpr const char* expected()
+    {
+        if constexpr (util::is_optional<T>)
+            return Slot<typename T::value_type>::expected();
+        else if constexpr (std::is_same_v<T, bool>)
+            return "boolean";
+        else if constexpr (std::is_arithmetic_v<T>)
+            return "number";
+        else if constexpr (std::is_same_v<T, json_t::string_t> || util::is_fixed_string<T> || std::is_enum_v<T>)
+            return "string";
+        else if constexpr (util::has_json_fields<T>::value || util::is_id_variant<T>)
+            return "object";
+        else if constexpr (util::is_variant<T>)
+            return "variant alternative";
+        else
+            return "value";
+    }
+
+    static constexpr bool capture()
+    {
+        if constexpr (util::is_optional<T>)
+            return Slot<typename T::value_type>::capture();
+        else
+            return !std::is_arithmetic_v<T> && !std::is_same_v<T, json_t::string_t> &&
+                   !util::is_fixed_string<T> && !detail::has_json_fields<T>::value;
+    }
+};
+
+template <typename T>
+struct TargetOps
+{
+    static constexpr Target::Ops value = {
+        [](void* o) { return Slot<T>::assign(*static_cast<T*>(o), nullptr); },
+        [](void* o, bool v) { return Slot<T>::assign(*static_cast<T*>(o), v); },
+        [](void* o, json_t::number_integer_t v) { return Slot<T>::assign(*static_cast<T*>(o), v); },
+        [](void* o, json_t::number_unsigned_t v) { return Slot<T>::assign(*static_cast<T*>(o), v); },
+        [](void* o, json_t::number_float_t v) { return Slot<T>::assign(*static_cast<T*>(o), v); },
+        [](void* o, json_t::string_t& v) { return Slot<T>::assign(*static_cast<T*>(o), std::move(v)); },
+        [](void* o) { return Slot<T>::start_object(*static_cast<T*>(o)); },
+        [](void* o, const json_t& j) { return Slot<T>::from_json(*static_cast<T*>(o), j); },
+        Slot<T>::capture(),
+        Slot<T>::expected(),
+    };
+};
+
+template <typename T>
+Target make_target(T& value)
+{
+    return Target{&value, &TargetOps<T>::value};
+}
+
+inline Target make_target(KeySelector& selector)
+{
+    static constexpr Target::Ops ops = {
+        [](void*) { return false; },
+        [](void*, bool) { return false; },
+        [](void*, json_t::number_integer_t) { return false; },
+        [](void*, json_t::number_unsigned_t) { return false; },
+        [](void*, json_t::number_float_t) { return false; },
+        [](void*, json_t::string_t&) { return false; },
+        [](void* o) -> std::unique_ptr<Frame> {
+            return std::make_unique<SelectFrame>(*static_cast<KeySelector*>(o));
+        },
+        [](void*, const json_t&) { return false; },
+        false,
+        "object",
+    };
+    return Target{&selector, &ops};
+}
+
+// Builds the json_t of a captured value from the SAX events of json_t::sax_parse
+class DomBuilder
+{
+public:
+    void clear()
+    {
+        root = json_t{};
+        stack.clear();
+        member = nullptr;
+    }
+
+    // The value built since the last clear
+    const json_t& value() const { return root; }
+
+    bool null() { return insert(nullptr); }
+    bool boolean(bool val) { return insert(val); }
+    bool number_integer(json_t::number_integer_t val) { return insert(val); }
+    bool number_unsigned(json_t::number_unsigned_t val) { return insert(val); }
+    bool number_float(json_t::number_float_t val, const json_t::string_t&) { return insert(val); }
+    bool string(json_t::string_t& val) { return insert(std::move(val)); }
+    bool binary(json_t::binary_t& val) { return insert(std::move(val)); }
+
+    bool start_object(std::size_t)
+    {
+        stack.push_back(emplace(json_t::object()));
+        return true;
+    }
+
+    bool key(const json_t::string_t& name)
+    {
+        member = &(*stack.back())[name];
+        return true;
+    }
+
+    bool end_object()
+    {
+        stack.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t)
+    {
+        stack.push_back(emplace(json_t::array()));
+        return true;
+    }
+
+    bool end_array()
+    {
+        stack.pop_back();
+        return true;
+    }
+
+private:
+    template <typename V>
+    bool insert(V&& val)
+    {
+        emplace(json_t(std::forward<V>(val)));
+        return true;
+    }
+
+    // Stores the value at its position in the enclosing container. Containers are only
+    // appended to while they are the innermost open one, so the pointers on the stack stay valid.
+    json_t* emplace(json_t&& val)
+    {
+        if (stack.empty())
+        {
+            root = std::move(val);
+            return &root;
+        }
+        json_t& parent = *stack.back();
+        if (parent.is_array())
+        {
+            auto& elements = parent.get_ref<json_t::array_t&>();
+            elements.push_back(std::move(val));
+            return &elements.back();
+        }
+        *member = std::move(val);
+        return member;
+    }
+
+    json_t root;
+    std::vector<json_t*> stack;
+    json_t* member = nullptr; // Value of the last key in the innermost object
+};
+
+/**
+ * @brief SAX handler for json_t::sax_parse writing into a Target.
+ */
+class Parser
+{
+public:
+    // Errors are reported into error if it is not nullptr
+    explicit Parser(Target root, ParseError* error = nullptr) : root(root), error(error)
+    {
+        stack.reserve(8);
+    }
+
+    bool null()
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.null();
+        const Target target = current();
+        return !target.ops || target.ops->null(target.object) || fail(target);
+    }
+
+    bool boolean(bool val)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.boolean(val);
+        const Target target = current();
+        return !target.ops || target.ops->boolean(target.object, val) || fail(target);
+    }
+
+    bool number_integer(json_t::number_integer_t val)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.number_integer(val);
+        const Target target = current();
+        return !target.ops || target.ops->number_integer(target.object, val) || fail(target);
+    }
+
+    bool number_unsigned(json_t::number_unsigned_t val)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.number_unsigned(val);
+        const Target target = current();
+        return !target.ops || target.ops->number_unsigned(target.object, val) || fail(target);
+    }
+
+    bool number_float(json_t::number_float_t val, const json_t::string_t& s)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.number_float(val, s);
+        const Target target = current();
+        return !target.ops || target.ops->number_float(target.object, val) || fail(target);
+    }
+
+    bool string(json_t::string_t& val)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.string(val);
+        const Target target = current();
+        return !target.ops || target.ops->string(target.object, val) || fail(target);
+    }
+
+    bool binary(json_t::binary_t& val)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.binary(val);
+        const Target target = current();
+        return !target.ops || fail(target);
+    }
+
+    bool start_object(std::size_t elements)
+    {
+        if (skipDepth || domDepth)
+            return nested(&DomBuilder::start_object, elements);
+
+        const Target target = current();
+        if (!target.ops)
+            return skip();
+        if (target.ops->capture)
+            return beginCapture(target) && dom.start_object(elements);
+
+        auto frame = target.ops->start_object(target.object);
+        if (!frame)
+            return fail(target);
+        stack.push_back(std::move(frame));
+        return true;
+    }
+
+    bool key(const json_t::string_t& val)
+    {
+        if (skipDepth)
+            return true;
+        if (domDepth)
+            return dom.key(val);
+        return !stack.empty() && stack.back()->key(val);
+    }
+
+    bool end_object()
+    {
+        if (skipDepth)
+            return unskip();
+        if (domDepth)
+            return dom.end_object() && endCapture();
+        if (stack.empty())
+            return false;
+
+        const bool complete = stack.back()->end();
+        if (!complete)
+            failMissing();
+        stack.pop_back();
+        if (stack.empty())
+            done = complete;
+        return complete;
+    }
+
+    bool start_array(std::size_t elements)
+    {
+        if (skipDepth || domDepth)
+            return nested(&DomBuilder::start_array, elements);
+
+        const Target target = current();
+        if (!target.ops)
+            return skip();
+        if (!target.ops->capture)
+            return fail(target);
+        return beginCapture(target) && dom.start_array(elements);
+    }
+
+    bool end_array()
+    {
+        if (skipDepth)
+            return unskip();
+        return domDepth && dom.end_array() && endCapture();
+    }
+
+    bool parse_error(std::size_t position,
+                     const std::string& /*last_token*/,
+                     const json_t::exception& /*ex*/)
+    {
+        syntaxError = true;
+        if (error)
+        {
+            error->status = ParseStatus::InvalidJson;
+            error->position = position;
+        }
+        return false;
+    }
+
+    // True if the root value was read completely
+    bool complete() const { return done; }
+
+    // True if parsing stopped because of malformed input
+    bool invalidInput() const { return syntaxError; }
+
+private:
+    // Container nested in a skipped or captured value
+    bool nested(bool (DomBuilder::*start)(std::size_t), std::size_t elements)
+    {
+        if (skipDepth)
+            return skip();
+        ++domDepth;
+        return (dom.*start)(elements);
+    }
+
+    bool skip()
+    {
+        ++skipDepth;
+        return true;
+    }
+
+    bool unskip()
+    {
+        --skipDepth;
+        return true;
+    }
+
+    Target current()
+    {
+        if (!stack.empty())
+            return stack.back()->next();
+        // Scalar root values are complete after the first event
+        done = true;
+        return root;
+    }
+
+    bool beginCapture(const Target& target)
+    {
+        captureTarget = target;
+        dom.clear();
+        domDepth = 1;
+        return true;
+    }
+
+    bool endCapture()
+    {
+        if (--domDepth)
+            return true;
+        const bool ok = captureTarget.ops->from_json(captureTarget.object, dom.value()) || fail(captureTarget);
+        if (stack.empty())
+            done = ok;
+        return ok;
+    }
+
+    // Error reports are only built on the failure path
+    bool fail(const Target& target)
+    {
+        if (error && !failed)
+            report(path(), target.ops->expected);
+        failed = true;
+        return false;
+    }
+
+    void failMissing()
+    {
+        if (error && !failed)
+        {
+            const auto [name, expected] = stack.back()->missing();
+            std::string location = path(stack.size() - 1);
+            if (!name.empty())
+                appendKey(location, name);
+            report(std::move(location), expected);
+        }
+        failed = true;
+    }
+
+    void report(std::string location, const char* expected)
+    {
+        error->status = ParseStatus::InvalidValue;
+        error->path = std::move(location);
+        error->expected = expected;
+    }
+
+    // JSON pointer of the current value, built from the keys of the first frames
+    std::string path(std::size_t frames) const
+    {
+        std::string result;
+        for (std::size_t i = 0; i < frames; ++i)
+            appendKey(result, stack[i]->currentKey());
+        return result;
+    }
+
+    std::string path() const { return path(stack.size()); }
+
+    // Appends /key with ~ and / escaped as defined by RFC 6901
+    static void appendKey(std::string& pointer, std::string_view key)
+    {
+        pointer += '/';
+        for (const char c : key)
+        {
+            if (c == '~')
+                pointer += "~0";
+            else if (c == '/')
+                pointer += "~1";
+            else
+                pointer += c;
+        }
+    }
+
+private:
+    Target root;
+    ParseError* error;
+    bool failed = false;
+    std::vector<std::unique_ptr<Frame>> stack;
+    std::size_t skipDepth = 0;
+    bool done = false;
+    bool syntaxError = false;
+
+    Target captureTarget;
+    DomBuilder dom;
+    std::size_t domDepth = 0; // Open containers of the captured value, 0 if nothing is captured
+};
+
+namespace detail
+{
+
+inline ParseStatus fail(ParseError* error, ParseStatus status)
+{
+    if (error)
+        error->status = status;
+    return status;
+}
+
+// Reports a missing or unknown id field of an IdVariant
+inline ParseStatus fail_id(ParseError* error, ParseStatus status, std::string_view key,
+                           std::string_view idField, std::string_view id = {})
+{
+    if (error)
+    {
+        error->status = status;
+        error->path.clear();
+        if (!key.empty())
+            error->path.append("/").append(key);
+        error->path.append("/").append(idField);
+        error->expected = status == ParseStatus::MissingId ? "string" : "known id";
+        error->standard = id;
+    }
+    return status;
+}
+
+} // namespace detail
+
+/**
+ * @brief Parses the contiguous input [first, last) into value without building a json_t.
+ * 
+ * @param key Optional key of the member of the root object holding the value.
+ *            If empty, the root value itself is parsed.
+ * @param format Input format, any format supported by json_t::sax_parse.
+ * @param error Optional error report, only written if parsing fails.
+ * 
+ * @return ParseStatus::Ok if the value was parsed completely.
+ */
+template <typename T, typename IteratorType>
+ParseStatus parse(IteratorType first,
+                  IteratorType last,
+                  T& value,
+                  std::string_view key = {},
+                  json_t::input_format_t format = json_t::input_format_t::json,
+                  ParseError* error = nullptr)
+{
+    KeySelector selector{key, make_target(value)};
+    Parser parser(key.empty() ? selector.target : make_target(selector), error);
+    if (json_t::sax_parse(first, last, &parser, format) && parser.complete())
+        return ParseStatus::Ok;
+    return detail::fail(error, parser.invalidInput() ? ParseStatus::InvalidJson : ParseStatus::InvalidValue);
+}
+
+namespace detail
+{
+
+// Generates the SAX events of an existing json_t
+template <typename Handler>
+bool walk(const json_t& j, Handler& handler)
+{
+    switch (j.type())
+    {
+    case json_t::value_t::null:
+        return handler.null();
+    case json_t::value_t::boolean:
+        return handler.boolean(j.get<json_t::boolean_t>());
+    case json_t::value_t::number_integer:
+        return handler.number_integer(j.get<json_t::number_integer_t>());
+    case json_t::value_t::number_unsigned:
+        return handler.number_unsigned(j.get<json_t::number_unsigned_t>());
+    case json_t::value_t::number_float:
+        return handler.number_float(j.get<json_t::number_float_t>(), json_t::string_t{});
+    case json_t::value_t::string:
+    {
+        json_t::string_t value = j.get_ref<const json_t::string_t&>();
+        return handler.string(value);
+    }
+    case json_t::value_t::binary:
+    {
+        json_t::binary_t value = j.get_binary();
+        return handler.binary(value);
+    }
+    case json_t::value_t::object:
+        if (!handler.start_object(j.size()))
+            return false;
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            if (!handler.key(it.key()) || !walk(it.value(), handler))
+                return false;
+        }
+        return handler.end_object();
+    case json_t::value_t::array:
+        if (!handler.start_array(j.size()))
+            return false;
+        for (const auto& element : j)
+        {
+            if (!walk(element, handler))
+                return false;
+        }
+        return handler.end_array();
+    case json_t::value_t::discarded:
+    default:
+        return false;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Reads value from an existing json_t without throwing.
+ *        The conversion follows the same rules as the generated from_json.
+ * 
+ * @param error Optional error report, only written if reading fails.
+ * 
+ * @return ParseStatus::Ok if the value was read completely.
+ */
+template <typename T>
+ParseStatus from_json(const json_t& j, T& value, ParseError* error = nullptr)
+{
+    Parser parser(make_target(value), error);
+    if (detail::walk(j, parser) && parser.complete())
+        return ParseStatus::Ok;
+    return detail::fail(error, ParseStatus::InvalidValue);
+}
+
+/**
+ * @brief Reads an IdVariant from an existing json_t without throwing.
+ *        The alternative is selected by the id field of j.
+ */
+template <char const* id_field_name, typename Seq>
+ParseStatus from_json(const json_t& j, IdVariant<id_field_name, Seq>& variant, ParseError* error = nullptr)
+{
+    const auto it = j.find(id_field_name);
+    if (it == j.end() || !it->is_string())
+        return detail::fail_id(error, ParseStatus::MissingId, {}, id_field_name);
+
+    const auto& id = it->template get_ref<const json_t::string_t&>();
+    const auto index = variant.findIndex(id);
+    if (!index)
+        return detail::fail_id(error, ParseStatus::UnknownId, {}, id_field_name, id);
+
+    const bool parsed = variant.emplace(*index, [&j, error](auto& alternative) {
+        if (sax::from_json(j, alternative, error) == ParseStatus::Ok)
+            return true;
+        if (error)
+            error->standard = std::decay_t<decltype(alternative)>::id;
+        return false;
+    });
+    return parsed ? ParseStatus::Ok : ParseStatus::InvalidValue;
+}
+
+namespace detail
+{
+
+// First pass over the input: locates the id field of an IdVariant in the root object
+// and in the object stored under key. Stops as soon as a known id was found under key.
+class IdScanner
+{
+public:
+    IdScanner(std::string_view idField, std::string_view key, bool (*known)(std::string_view)) :
+        idField(idField),
+        variantKey(key),
+        known(known)
+    {
+    }
+
+    bool null() { return value(); }
+    bool boolean(bool) { return value(); }
+    bool number_integer(json_t::number_integer_t) { return value(); }
+    bool number_unsigned(json_t::number_unsigned_t) { return value(); }
+    bool number_float(json_t::number_float_t, const json_t::string_t&) { return value(); }
+    bool binary(json_t::binary_t&) { return value(); }
+
+    bool string(json_t::string_t& val)
+    {
+        if (depth == 1 && rootIdNext)
+        {
+            rootId = val;
+        }
+        else if (depth == 2 && inKeyed && keyedIdNext)
+        {
+            keyedId = val;
+            if (known(val))
+            {
+                stopped = true;
+                return false;
+            }
+        }
+        return value();
+    }
+
+    bool start_object(std::size_t)
+    {
+        const bool isKeyed = depth == 1 && keyNext;
+        value();
+        ++depth;
+        if (isKeyed)
+            inKeyed = keyedObject = true;
+        return true;
+    }
+
+    bool key(json_t::string_t& val)
+    {
+        if (depth == 1)
+        {
+            rootIdNext = val == idField;
+            keyNext = !variantKey.empty() && val == variantKey;
+        }
+        else if (depth == 2 && inKeyed)
+        {
+            keyedIdNext = val == idField;
+        }
+        return true;
+    }
+
+    bool end_object()
+    {
+        if (depth == 2)
+            inKeyed = false;
+        --depth;
+        return true;
+    }
+
+    bool start_array(std::size_t)
+    {
+        value();
+        ++depth;
+        return true;
+    }
+
+    bool end_array()
+    {
+        --depth;
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const json_t::exception&)
+    {
+        errorPosition = position;
+        return false;
+    }
+
+public:
+    std::size_t errorPosition = 0;
+    bool keyedObject = false; // The member stored under key is an object
+    std::optional<std::string> rootId;
+    std::optional<std::string> keyedId;
+    bool stopped = false;
+
+private:
+    bool value()
+    {
+        if (depth == 1)
+        {
+            rootIdNext = false;
+            keyNext = false;
+        }
+        else if (depth == 2)
+        {
+            keyedIdNext = false;
+        }
+        return true;
+    }
+
+private:
+    std::string_view idField;
+    std::string_view variantKey;
+    bool (*known)(std::string_view);
+
+    std::size_t depth = 0;
+    bool rootIdNext = false;
+    bool keyNext = false;
+    bool keyedIdNext = false;
+    bool inKeyed = false;
+};
+
+} // namespace detail
+
+/**
+ * @brief Parses an IdVariant from the contiguous input [first, last) without building a json_t.
+ *        The input is read twice: once to find the id field and once to parse the selected type.
+ * 
+ * The lookup matches parse_memspec_from_json: if the object stored under key has a known id,
+ * the variant is read from there. Otherwise the root object is used.
+ * 
+ * @return ParseStatus::Ok if the variant was parsed completely.
+ */
+template <char const* id_field_name, typename Seq, typename IteratorType>
+ParseStatus parse(IteratorType first,
+                  IteratorType last,
+                  IdVariant<id_field_name, Seq>& variant,
+                  std::string_view key = {},
+                  json_t::input_format_t format = json_t::input_format_t::json,
+                  ParseError* error = nullptr)
+{
+    using Variant = IdVariant<id_field_name, Seq>;
+    constexpr auto known = [](std::string_view id) { return Variant::findIndex(id).has_value(); };
+
+    detail::IdScanner scanner(id_field_name, key, known);
+    if (!json_t::sax_parse(first, last, &scanner, format) && !scanner.stopped)
+    {
+        if (error)
+            error->position = scanner.errorPosition;
+        return detail::fail(error, ParseStatus::InvalidJson);
+    }
+
+    const auto parseAt = [&](std::size_t index, std::string_view path) {
+        ParseStatus status = ParseStatus::InvalidValue;
+        variant.emplace(index, [&](auto& alternative) {
+            status = sax::parse(first, last, alternative, path, format, error);
+            if (status != ParseStatus::Ok && error)
+                error->standard = std::decay_t<decltype(alternative)>::id;
+            return status == ParseStatus::Ok;
+        });
+        return status;
+    };
+
+    if (scanner.keyedId)
+    {
+        if (const auto index = Variant::findIndex(*scanner.keyedId))
+            return parseAt(*index, key);
+    }
+    if (!scanner.rootId)
+    {
+        if (scanner.keyedId)
+            return detail::fail_id(error, ParseStatus::UnknownId, key, id_field_name, *scanner.keyedId);
+        // Matches parse_memspec_from_json: the keyed object is reported if it exists
+        return detail::fail_id(error, ParseStatus::MissingId, scanner.keyedObject ? key : std::string_view{}, id_field_name);
+    }
+    if (const auto index = Variant::findIndex(*scanner.rootId))
+        return parseAt(*index, {});
+    return detail::fail_id(error, ParseStatus::UnknownId, {}, id_field_name, *scanner.rootId);
+}
+
+} // namespace DRAMUtils::util::sax
+
+#endif /* DRAMUTILS_UTIL_JSON_SAX_H */
@@ -40,28 +40,297 @@
 
 #include "json.h"
 
+#include "fixed_string.h"
 #include "id_variant.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <variant>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 
 
 namespace DRAMUtils::util
 {
-// See https://www.kdab.com/jsonify-with-nlohmann-json/
-// Try to set the value of type T into the variant data if it fails, do nothing
-template<typename T, typename... Ts>
-void variant_from_json(const json_t& j, std::variant<Ts...>& data)
+template <typename>
+constexpr bool is_optional = false;
+template <typename T>
+constexpr bool is_optional<std::optional<T>> = true;
+
+template <typename>
+constexpr bool is_variant = false;
+template <typename... Ts>
+constexpr bool is_variant<std::variant<Ts...>> = true;
+
+template <typename>
+constexpr bool is_id_variant = false;
+template <char const * id_field_name, typename Seq>
+constexpr bool is_id_variant<IdVariant<id_field_name, Seq>> = true;
+
+namespace detail
+{
+
+struct field_probe
+{
+    template <typename T>
+    bool operator()(std::string_view, T&) const { return false; }
+};
+
+template <typename>
+constexpr bool is_sequence = false;
+template <typename T, typename Alloc>
+constexpr bool is_sequence<std::vector<T, Alloc>> = true;
+template <typename T, std::size_t N>
+constexpr bool is_sequence<std::array<T, N>> = true;
+
+} // namespace detail
+
+// True for structs declared with NLOHMANN_JSONIFY_ALL_THINGS
+template <typename T, typename = void>
+struct has_json_fields : std::false_type {};
+template <typename T>
+struct has_json_fields<T, std::void_t<decltype(visit_json_fields(std::declval<T&>(), detail::field_probe{}))>>
+    : std::true_type {};
+
+// True for enums declared with DRAMUTILS_JSON_SERIALIZE_ENUM
+template <typename T, typename = void>
+struct has_json_enum_text : std::false_type {};
+template <typename T>
+struct has_json_enum_text<T, std::void_t<decltype(json_enum_text(std::declval<const T&>()))>>
+    : std::true_type {};
+
+// Tag to find the field list generated by NLOHMANN_JSONIFY_ALL_THINGS for T by ADL
+template <typename T>
+struct field_tag {};
+
+// Names of the fields of T in declaration order of the field list
+template <typename T>
+constexpr auto field_names = json_field_names(field_tag<T>{});
+
+template <typename T>
+constexpr std::size_t field_count = field_names<T>.size();
+
+// Compile time name and position of the I-th field of T, passed to for_each_field visitors
+template <typename T, std::size_t I>
+struct FieldName
+{
+    static constexpr std::size_t index = I;
+    static constexpr std::string_view value = field_names<T>[I];
+
+    constexpr operator std::string_view() const noexcept { return value; }
+};
+
+// Type of the I-th field of T
+template <typename T, std::size_t I>
+using field_type =
+    std::decay_t<decltype(std::declval<T&>().*std::get<I>(json_field_pointers(field_tag<T>{})))>;
+
+// Position of the field with the given name or std::nullopt if T has no such field
+template <typename T>
+constexpr std::optional<std::size_t> field_index(std::string_view name) noexcept
 {
-    try
+    for (std::size_t i = 0; i < field_count<T>; ++i)
     {
-        data = j.get<T>();
+        if (field_names<T>[i] == name)
+            return i;
     }
-    catch (...)
+    return std::nullopt;
+}
+
+// True if names lists the fields of T in declaration order, except the field skip.
+// Used to check hand written field lists against the field list of T at compile time.
+template <typename T, std::size_t N>
+constexpr bool lists_fields(const std::string_view (&names)[N], std::string_view skip = {}) noexcept
+{
+    std::size_t i = 0;
+    for (const std::string_view field : field_names<T>)
     {
+        if (field == skip)
+            continue;
+        if (i == N || names[i] != field)
+            return false;
+        ++i;
     }
+    return i == N;
+}
+
+namespace detail
+{
+
+template <typename T, typename Visitor, std::size_t... Is>
+constexpr void for_each_field(T& obj, Visitor& visitor, std::index_sequence<Is...>)
+{
+    using Type = std::remove_const_t<T>;
+    constexpr auto pointers = json_field_pointers(field_tag<Type>{});
+    (visitor(FieldName<Type, Is>{}, obj.*std::get<Is>(pointers)), ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Calls visitor(name, field) for every field of a struct declared with
+ *        NLOHMANN_JSONIFY_ALL_THINGS in order. name is a FieldName<T, I>, so the name and
+ *        index of the field are constant expressions, e.g. decltype(name)::value.
+ *        The fields are mutable if obj is.
+ */
+template <typename T, typename Visitor>
+constexpr void for_each_field(T& obj, Visitor&& visitor)
+{
+    detail::for_each_field(obj, visitor, std::make_index_sequence<field_count<std::remove_const_t<T>>>{});
+}
+
+namespace detail
+{
+
+template <typename T, std::size_t... Is>
+constexpr bool has_variant_field(std::index_sequence<Is...>) noexcept
+{
+    return (is_variant<field_type<T, Is>> || ...);
+}
+
+template <typename T>
+constexpr bool has_variant_field() noexcept
+{
+    if constexpr (has_json_fields<T>::value)
+        return has_variant_field<T>(std::make_index_sequence<field_count<T>>{});
+    else
+        return false;
+}
+
+} // namespace detail
+
+// True for structs declared with NLOHMANN_JSONIFY_ALL_THINGS with a std::variant field.
+// std::variant fields are read from and written to the enclosing object, not to their own key.
+template <typename T>
+constexpr bool has_variant_field = detail::has_variant_field<T>();
+
+
+// The json conversions are compiled into the library in DRAMUTILS_COMPILED mode
+#ifndef DRAMUTILS_DECLARE_ONLY
+
+template <typename T>
+bool json_matches(const json_t& j) noexcept;
+
+namespace detail
+{
+
+// Json text of every entry of an enum serializer table
+template <typename Enum, std::size_t N>
+std::vector<std::pair<Enum, std::string>> json_enum_texts(const std::pair<Enum, json_t> (&table)[N])
+{
+    std::vector<std::pair<Enum, std::string>> texts;
+    texts.reserve(N);
+    for (const auto& [value, j] : table)
+        texts.emplace_back(value, j.dump());
+    return texts;
+}
+
+// Text of value or an empty string if value is not in the table
+template <typename Enum>
+std::string_view find_json_enum_text(const std::vector<std::pair<Enum, std::string>>& texts, Enum value) noexcept
+{
+    const auto it = std::find_if(texts.begin(), texts.end(),
+                                 [value](const auto& entry) { return entry.first == value; });
+    return it != texts.end() ? std::string_view(it->second) : std::string_view{};
+}
+
+template <typename T, std::size_t I>
+bool field_matches(const json_t& j) noexcept
+{
+    using Field = field_type<T, I>;
+    // Same layout as extended_from_json: std::variant fields use the enclosing object
+    if constexpr (is_variant<Field>)
+        return json_matches<Field>(j);
+    const auto it = j.find(FieldName<T, I>::value);
+    if (it == j.end())
+        return is_optional<Field>;
+    return json_matches<Field>(*it);
+}
+
+template <typename T, std::size_t... Is>
+bool fields_match(const json_t& j, std::index_sequence<Is...>) noexcept
+{
+    // Short circuits at the first mismatch
+    return j.is_object() && (field_matches<T, Is>(j) && ...);
+}
+
+// The pointer only selects the overload
+template <typename... Ts>
+bool variant_matches(const json_t& j, const std::variant<Ts...>*) noexcept
+{
+    return (json_matches<Ts>(j) || ...);
+}
+
+template <const char* id_field_name, typename Seq>
+bool id_variant_matches(const json_t& j, const IdVariant<id_field_name, Seq>*) noexcept
+{
+    if (!j.is_object())
+        return false;
+    const auto it = j.find(id_field_name);
+    return it != j.end() && it->is_string() &&
+           IdVariant<id_field_name, Seq>::findIndex(it->template get_ref<const std::string&>()).has_value();
+}
+
+template <typename... Ts, std::size_t... Is>
+void variant_from_json(const json_t& j, std::variant<Ts...>& data, std::index_sequence<Is...>)
+{
+    // The last match wins, as when every alternative was converted in turn.
+    // Only the selected alternative is converted.
+    std::size_t match = sizeof...(Ts);
+    ((json_matches<Ts>(j) ? (void)(match = Is) : (void)0), ...);
+    (void)((match == Is && (data.template emplace<Is>(j.get<Ts>()), true)) || ...);
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks without throwing if the json value has the shape of T, i.e. the value kind
+ *        fits and all required fields of JSONIFY structs are present and match recursively.
+ *        Types without a known schema match any value.
+ */
+template <typename T>
+bool json_matches(const json_t& j) noexcept
+{
+    if constexpr (is_optional<T>)
+        return j.is_null() || json_matches<typename T::value_type>(j);
+    else if constexpr (std::is_same_v<T, bool>)
+        return j.is_boolean();
+    else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>)
+        return j.is_number_unsigned() || (j.is_number_integer() && j.template get<std::int64_t>() >= 0);
+    else if constexpr (std::is_integral_v<T>)
+        return j.is_number_integer();
+    else if constexpr (std::is_floating_point_v<T>)
+        return j.is_number();
+    else if constexpr (std::is_enum_v<T> || std::is_same_v<T, std::string> || is_fixed_string<T>)
+        return j.is_string();
+    else if constexpr (is_id_variant<T>)
+        return detail::id_variant_matches(j, static_cast<const T*>(nullptr));
+    else if constexpr (is_variant<T>)
+        return detail::variant_matches(j, static_cast<const T*>(nullptr));
+    else if constexpr (detail::is_sequence<T>)
+        return j.is_array();
+    else if constexpr (has_json_fields<T>::value)
+        return detail::fields_match<T>(j, std::make_index_sequence<field_count<T>>{});
+    else
+        return true;
+}
+
+// See https://www.kdab.com/jsonify-with-nlohmann-json/
+// Sets the last alternative of data whose schema matches the json value, e.g. an unsigned
+// number selects uint64_t in std::variant<double, uint64_t>.
+// If no alternative matches, data is left unchanged.
+template <typename... Ts>
+void variant_from_json(const json_t& j, std::variant<Ts...>& data)
+{
+    detail::variant_from_json(j, data, std::index_sequence_for<Ts...>{});
 }
 
 template <typename... Ts>
@@ -134,22 +403,6 @@ void id_variant_to_json(json_t& j, const IdVariant<id_field_name, Seq>& data, st
 
 }
 
-template <typename>
-constexpr bool is_optional = false;
-template <typename T>
-constexpr bool is_optional<std::optional<T>> = true;
-
-template <typename>
-constexpr bool is_variant = false;
-template <typename... Ts>
-constexpr bool is_variant<std::variant<Ts...>> = true;
-
-template <typename>
-constexpr bool is_id_variant = false;
-template <char const * id_field_name, typename Seq>
-constexpr bool is_id_variant<IdVariant<id_field_name, Seq>> = true;
-
-
 template <typename T> void extended_to_json(const char* key, json_t& j, const T& value)
 {
     if constexpr (is_optional<T>)
@@ -169,13 +422,17 @@ template <typename T> void extended_from_json(const char* key, const json_t& j,
     else if constexpr (is_id_variant<T>)
         id_variant_from_json(j, value, key);
     else if constexpr (is_variant<T>)
-        variant_from_json<T>(j, value);
+        variant_from_json(j, value);
     else
         j.at(key).get_to(value);
 }
 
+#endif /* DRAMUTILS_DECLARE_ONLY */
+
 } // namespace DRAMUtils::util
 
+#ifndef DRAMUTILS_DECLARE_ONLY
+
 NLOHMANN_JSON_NAMESPACE_BEGIN
 
 template <typename T> struct adl_serializer<std::optional<T>>
@@ -214,8 +471,7 @@ template <typename... Ts> struct adl_serializer<std::variant<Ts...>>
 
     static void from_json(const json_t& j, std::variant<Ts...>& data)
     {
-        // Call variant_from_json for all types, only one will succeed
-        (DRAMUtils::util::variant_from_json<Ts>(j, data), ...);
+        DRAMUtils::util::variant_from_json(j, data);
     }
 };
 
@@ -235,26 +491,128 @@ template <const char * id_field_name, typename Seq> struct adl_serializer<DRAMUt
 };
 
 
+NLOHMANN_JSON_NAMESPACE_END
+
+#endif /* DRAMUTILS_DECLARE_ONLY */
+
 // NOLINTBEGIN(cppcoreguidelines-macro-usage)
 
 #define EXTEND_JSON_TO(v1)                                                                         \
     DRAMUtils::util::extended_to_json(#v1, nlohmann_json_j, nlohmann_json_t.v1);
 #define EXTEND_JSON_FROM(v1)                                                                       \
     DRAMUtils::util::extended_from_json(#v1, nlohmann_json_j, nlohmann_json_t.v1);
+#define EXTEND_JSON_VISIT(v1)                                                                      \
+    if (nlohmann_json_visitor(std::string_view(#v1, sizeof(#v1) - 1), nlohmann_json_t.v1))         \
+        return true;
+#define EXTEND_JSON_NAME(v1) std::string_view(#v1, sizeof(#v1) - 1),
+#define EXTEND_JSON_POINTER(v1) &nlohmann_json_type::v1,
+#define EXTEND_JSON_COMPARE(v1)                                                                    \
+    if (!(nlohmann_json_lhs.v1 == nlohmann_json_rhs.v1))                                           \
+        return false;
 
 // NOLINTEND(cppcoreguidelines-macro-usage)
 
+// Besides to_json and from_json, visit_json_fields(obj, visitor) is generated for mutable and
+// const objects. It calls visitor(name, field) for every listed field in order until the
+// visitor returns true.
+#define DRAMUTILS_JSONIFY_VISIT(Type, ...)                                                         \
+    template <typename Visitor>                                                                    \
+    inline bool visit_json_fields(Type& nlohmann_json_t, Visitor&& nlohmann_json_visitor)          \
+    {                                                                                              \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_VISIT, __VA_ARGS__))                          \
+        return false;                                                                              \
+    }                                                                                              \
+    template <typename Visitor>                                                                    \
+    inline bool visit_json_fields(const Type& nlohmann_json_t, Visitor&& nlohmann_json_visitor)    \
+    {                                                                                              \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_VISIT, __VA_ARGS__))                          \
+        return false;                                                                              \
+    }
+
+// Compile time field list for util::for_each_field, the names as constexpr array and the
+// member pointers as constexpr tuple
+#define DRAMUTILS_JSONIFY_FIELDS(Type, ...)                                                        \
+    constexpr auto json_field_names(DRAMUtils::util::field_tag<Type>) noexcept                     \
+    {                                                                                              \
+        return std::array{DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_NAME, __VA_ARGS__))};        \
+    }                                                                                              \
+    constexpr auto json_field_pointers(DRAMUtils::util::field_tag<Type>) noexcept                  \
+    {                                                                                              \
+        using nlohmann_json_type = Type;                                                           \
+        return std::tuple{DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_POINTER, __VA_ARGS__))};    \
+    }
+
+// Field-wise operator== and operator!= over the listed fields, the same fields that are
+// serialized. Floating point fields compare with ==, so 0.0 equals -0.0 and NaN never matches.
+#define DRAMUTILS_JSONIFY_COMPARE(Type, ...)                                                       \
+    inline bool operator==(const Type& nlohmann_json_lhs, const Type& nlohmann_json_rhs)           \
+    {                                                                                              \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_COMPARE, __VA_ARGS__))                        \
+        return true;                                                                               \
+    }                                                                                              \
+    inline bool operator!=(const Type& nlohmann_json_lhs, const Type& nlohmann_json_rhs)           \
+    {                                                                                              \
+        return !(nlohmann_json_lhs == nlohmann_json_rhs);                                          \
+    }
+
+#ifdef DRAMUTILS_DECLARE_ONLY
+
+// Only declarations, the definitions are part of the compiled library
+#define NLOHMANN_JSONIFY_ALL_THINGS(Type, ...)                                                     \
+    void to_json(json_t& nlohmann_json_j, const Type& nlohmann_json_t);                            \
+    void from_json(const json_t& nlohmann_json_j, Type& nlohmann_json_t);                          \
+    DRAMUTILS_JSONIFY_VISIT(Type, __VA_ARGS__)                                                     \
+    DRAMUTILS_JSONIFY_FIELDS(Type, __VA_ARGS__)                                                    \
+    DRAMUTILS_JSONIFY_COMPARE(Type, __VA_ARGS__)
+
+#define DRAMUTILS_JSON_SERIALIZE_ENUM(ENUM_TYPE, ...)                                              \
+    void to_json(json_t& j, const ENUM_TYPE& e);                                                   \
+    void from_json(const json_t& j, ENUM_TYPE& e);                                                 \
+    std::string_view json_enum_text(const ENUM_TYPE& e);
+
+#else
+
 #define NLOHMANN_JSONIFY_ALL_THINGS(Type, ...)                                                     \
-    inline void to_json(json_t& nlohmann_json_j, const Type& nlohmann_json_t)                      \
+    DRAMUTILS_INLINE void to_json(json_t& nlohmann_json_j, const Type& nlohmann_json_t)            \
+    {                                                                                              \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_TO, __VA_ARGS__))                             \
+    }                                                                                              \
+    DRAMUTILS_INLINE void from_json(const json_t& nlohmann_json_j, Type& nlohmann_json_t)          \
     {                                                                                              \
-        NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(EXTEND_JSON_TO, __VA_ARGS__))                     \
+        DRAMUTILS_EXPAND(DRAMUTILS_PASTE(EXTEND_JSON_FROM, __VA_ARGS__))                           \
     }                                                                                              \
-    inline void from_json(const json_t& nlohmann_json_j, Type& nlohmann_json_t)                    \
+    DRAMUTILS_JSONIFY_VISIT(Type, __VA_ARGS__)                                                     \
+    DRAMUTILS_JSONIFY_FIELDS(Type, __VA_ARGS__)                                                    \
+    DRAMUTILS_JSONIFY_COMPARE(Type, __VA_ARGS__)
+
+// json_enum_text(e) returns the json text of e from the serializer table, e.g. "\"L\"" or "null",
+// so writers do not need to build a json_t per value. Values missing from the table give an
+// empty string, to_json writes them as the first entry. The texts are built on first use.
+#define DRAMUTILS_JSON_ENUM_TEXT(ENUM_TYPE, ...)                                                   \
+    DRAMUTILS_INLINE std::string_view json_enum_text(const ENUM_TYPE& e)                           \
     {                                                                                              \
-        NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(EXTEND_JSON_FROM, __VA_ARGS__))                   \
+        static const std::pair<ENUM_TYPE, json_t> table[] = __VA_ARGS__;                           \
+        static const auto texts = DRAMUtils::util::detail::json_enum_texts(table);                 \
+        return DRAMUtils::util::detail::find_json_enum_text(texts, e);                             \
     }
 
+#ifdef DRAMUTILS_COMPILED
 
-NLOHMANN_JSON_NAMESPACE_END
+// NLOHMANN_JSON_SERIALIZE_ENUM only generates templates, the library exports json_t overloads
+#define DRAMUTILS_JSON_SERIALIZE_ENUM(ENUM_TYPE, ...)                                              \
+    NLOHMANN_JSON_SERIALIZE_ENUM(ENUM_TYPE, __VA_ARGS__)                                           \
+    void to_json(json_t& j, const ENUM_TYPE& e) { to_json<json_t>(j, e); }                         \
+    void from_json(const json_t& j, ENUM_TYPE& e) { from_json<json_t>(j, e); }                     \
+    DRAMUTILS_JSON_ENUM_TEXT(ENUM_TYPE, __VA_ARGS__)
+
+#else
+
+#define DRAMUTILS_JSON_SERIALIZE_ENUM(ENUM_TYPE, ...)                                              \
+    NLOHMANN_JSON_SERIALIZE_ENUM(ENUM_TYPE, __VA_ARGS__)                                           \
+    DRAMUTILS_JSON_ENUM_TEXT(ENUM_TYPE, __VA_ARGS__)
+
+#endif /* DRAMUTILS_COMPILED */
+
+#endif /* DRAMUTILS_DECLARE_ONLY */
 
 #endif /* DRAMUTILS_UTIL_JSON_UTILS_H */
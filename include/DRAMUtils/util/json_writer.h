@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+#ifndef DRAMUTILS_UTIL_JSON_WRITER_H
+#define DRAMUTILS_UTIL_JSON_WRITER_H
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "json_utils.h"
+
+namespace DRAMUtils::util
+{
+
+// Appends the json text to a std::string
+struct StringSink
+{
+    std::string& out;
+
+    void append(const char* data, std::size_t size) { out.append(data, size); }
+};
+
+// Writes the json text to a std::ostream
+struct StreamSink
+{
+    std::ostream& out;
+
+    void append(const char* data, std::size_t size) { out.write(data, static_cast<std::streamsize>(size)); }
+};
+
+// Writes the json text into a fixed buffer. Like snprintf, length counts the full text even if it
+// does not fit into the buffer. The text is not null terminated.
+struct BufferSink
+{
+    char* data;
+    std::size_t size;
+    std::size_t length = 0;
+
+    void append(const char* text, std::size_t count) noexcept
+    {
+        if (length < size)
+            std::memcpy(data + length, text, std::min(count, size - length));
+        length += count;
+    }
+};
+
+/**
+ * @brief Writes json text of JSONIFY structs, IdVariants and their field types straight into a
+ *        sink, without building a json_t. Fields are written in declaration order and absent
+ *        optional fields are skipped, the id field of an IdVariant comes first.
+ *        The text parses to the same json value as json_t(value).dump(indent).
+ */
+template <typename Sink>
+class JsonWriter
+{
+public:
+    // indent < 0 writes compact text, otherwise the same layout as json_t::dump(indent)
+    explicit JsonWriter(Sink& sink, int indent = -1) noexcept :
+        sink_(sink),
+        indent_(indent)
+    {}
+
+    template <typename T>
+    void write(const T& value)
+    {
+        if constexpr (is_optional<T>)
+        {
+            if (value)
+                write(*value);
+            else
+                raw("null");
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+            raw(value ? "true" : "false");
+        else if constexpr (std::is_integral_v<T>)
+            integer(value);
+        else if constexpr (std::is_floating_point_v<T>)
+            floating(static_cast<double>(value));
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            string(value);
+        else if constexpr (is_id_variant<T>)
+        {
+            std::visit([this, &value](const auto& alternative) {
+                if constexpr (has_variant_field<std::decay_t<decltype(alternative)>>)
+                    return write(json_t(value));
+                bool first = true;
+                begin('{');
+                member(first, T::idFieldName(), alternative.id);
+                fields(first, alternative);
+                end('}', first);
+            }, value.getVariant());
+        }
+        else if constexpr (is_variant<T>)
+            std::visit([this](const auto& alternative) { write(alternative); }, value);
+        else if constexpr (has_json_enum_text<T>::value)
+        {
+            const std::string_view text = json_enum_text(value);
+            if (text.empty())
+                write(json_t(value));
+            else
+                raw(text);
+        }
+        else if constexpr (detail::is_sequence<T>)
+        {
+            bool first = true;
+            begin('[');
+            for (const auto& element : value)
+            {
+                separator(first);
+                write(element);
+            }
+            end(']', first);
+        }
+        else if constexpr (has_json_fields<T>::value && !has_variant_field<T>)
+        {
+            bool first = true;
+            begin('{');
+            fields(first, value);
+            end('}', first);
+        }
+        else
+        {
+            // Types with custom conversions and structs with std::variant fields,
+            // which are merged into the enclosing object
+            write(json_t(value));
+        }
+    }
+
+    // Writes an object with the single member name, e.g. {"memspec": ...}
+    template <typename T>
+    void writeObject(std::string_view name, const T& value)
+    {
+        bool first = true;
+        begin('{');
+        member(first, name, value);
+        end('}', first);
+    }
+
+    void write(const json_t& value)
+    {
+        const std::string text = value.dump(indent_ < 0 ? -1 : indent_);
+        // Nested values continue the indentation of the current level
+        if (indent_ <= 0 || depth_ == 0)
+            return raw(text);
+        std::size_t start = 0;
+        for (std::size_t pos = text.find('\n'); pos != std::string::npos; pos = text.find('\n', start))
+        {
+            sink_.append(text.data() + start, pos - start);
+            newline();
+            start = pos + 1;
+        }
+        sink_.append(text.data() + start, text.size() - start);
+    }
+
+private:
+    template <typename T>
+    void fields(bool& first, const T& value)
+    {
+        for_each_field(value, [this, &first](auto name, const auto& field) {
+            member(first, name, field);
+        });
+    }
+
+    template <typename T>
+    void member(bool& first, std::string_view name, const T& value)
+    {
+        if constexpr (is_optional<T>)
+        {
+            if (!value)
+                return;
+        }
+        separator(first);
+        string(name);
+        raw(indent_ < 0 ? ":" : ": ");
+        write(value);
+    }
+
+    void begin(char bracket)
+    {
+        sink_.append(&bracket, 1);
+        ++depth_;
+    }
+
+    void end(char bracket, bool empty)
+    {
+        --depth_;
+        if (!empty)
+            newline();
+        sink_.append(&bracket, 1);
+    }
+
+    void separator(bool& first)
+    {
+        if (!first)
+            raw(",");
+        first = false;
+        newline();
+    }
+
+    void newline()
+    {
+        if (indent_ < 0)
+            return;
+        static constexpr char spaces[] = "\n                                                               ";
+        std::size_t count = static_cast<std::size_t>(indent_) * static_cast<std::size_t>(depth_) + 1;
+        const char* chunk = spaces;
+        while (count > 0)
+        {
+            const std::size_t size = std::min(count, sizeof(spaces) - 1);
+            sink_.append(chunk, size);
+            count -= size;
+            chunk = spaces + 1;
+        }
+    }
+
+    void raw(std::string_view text) { sink_.append(text.data(), text.size()); }
+
+    template <typename T>
+    void integer(T value)
+    {
+        char buffer[24];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        sink_.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+    }
+
+    // Shortest representation that round trips, json_t writes a trailing ".0" for integral values
+    void floating(double value)
+    {
+        if (!std::isfinite(value))
+            return raw("null");
+#if defined(__cpp_lib_to_chars)
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        std::size_t size = static_cast<std::size_t>(result.ptr - buffer);
+        if (std::string_view(buffer, size).find_first_of(".e") == std::string_view::npos)
+        {
+            buffer[size++] = '.';
+            buffer[size++] = '0';
+        }
+        sink_.append(buffer, size);
+#else
+        // Without floating point std::to_chars, json_t formats the number: unlike snprintf it
+        // does not depend on the decimal point of the current locale
+        raw(json_t(value).dump());
+#endif
+    }
+
+    void string(std::string_view text)
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+        raw("\"");
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < text.size(); ++i)
+        {
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x20 && c != '"' && c != '\\')
+                continue;
+
+            sink_.append(text.data() + start, i - start);
+            start = i + 1;
+            switch (c)
+            {
+            case '"': raw("\\\""); break;
+            case '\\': raw("\\\\"); break;
+            case '\b': raw("\\b"); break;
+            case '\f': raw("\\f"); break;
+            case '\n': raw("\\n"); break;
+            case '\r': raw("\\r"); break;
+            case '\t': raw("\\t"); break;
+            default:
+            {
+                const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+                sink_.append(escaped, sizeof(escaped));
+            }
+            }
+        }
+        sink_.append(text.data() + start, text.size() - start);
+        raw("\"");
+    }
+
+    Sink& sink_;
+    int indent_;
+    int depth_ = 0;
+};
+
+template <typename Sink, typename T>
+void write_json(Sink& sink, const T& value, int indent = -1)
+{
+    JsonWriter<Sink>(sink, indent).write(value);
+}
+
+} // namespace DRAMUtils::util
+
+#endif /* DRAMUTILS_UTIL_JSON_WRITER_H */
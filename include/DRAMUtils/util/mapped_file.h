@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_UTIL_MAPPED_FILE_H
+#define DRAMUTILS_UTIL_MAPPED_FILE_H
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DRAMUTILS_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define DRAMUTILS_HAS_MMAP 0
+#endif
+
+namespace DRAMUtils::util
+{
+
+/**
+ * @brief Read-only view of a whole file.
+ *        On POSIX systems the file is memory mapped. If mapping is not available or fails,
+ *        e.g. for empty files or special files, the file is read into a buffer instead.
+ *        Open errors are reported by isOpen() and never thrown.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+#if DRAMUTILS_HAS_MMAP
+        if (map(path))
+            return;
+#endif
+        read(path);
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : m_buffer(std::move(other.m_buffer))
+        , m_mapping(std::exchange(other.m_mapping, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_open(std::exchange(other.m_open, false))
+    {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            m_buffer = std::move(other.m_buffer);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_open = std::exchange(other.m_open, false);
+        }
+        return *this;
+    }
+
+    bool isOpen() const noexcept { return m_open; }
+    bool isMapped() const noexcept { return m_mapping != nullptr; }
+
+    std::string_view view() const noexcept
+    {
+        if (m_mapping)
+            return {static_cast<const char*>(m_mapping), m_size};
+        return m_buffer;
+    }
+
+private:
+#if DRAMUTILS_HAS_MMAP
+    bool map(const std::filesystem::path& path) noexcept
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+        {
+            void* mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED)
+            {
+                // The file is read front to back exactly once
+                ::madvise(mapping, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+                m_mapping = mapping;
+                m_size = static_cast<std::size_t>(info.st_size);
+                m_open = true;
+            }
+        }
+        ::close(fd);
+        return m_open;
+    }
+#endif
+
+    void read(const std::filesystem::path& path) noexcept
+    {
+        try
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file.is_open())
+                return;
+
+            m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            m_open = !file.bad();
+        }
+        catch (std::exception&)
+        {
+            // e.g. reading a directory
+            m_buffer.clear();
+            m_open = false;
+        }
+    }
+
+    void unmap() noexcept
+    {
+#if DRAMUTILS_HAS_MMAP
+        if (m_mapping)
+            ::munmap(m_mapping, m_size);
+#endif
+        m_mapping = nullptr;
+        m_size = 0;
+    }
+
+    std::string m_buffer;
+    void* m_mapping = nullptr;
+    std::size_t m_size = 0;
+    bool m_open = false;
+};
+
+} // namespace DRAMUtils::util
+
+#endif /* DRAMUTILS_UTIL_MAPPED_FILE_H */
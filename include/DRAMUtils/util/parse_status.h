@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Marco Mörz
+ */
+
+#ifndef DRAMUTILS_UTIL_PARSE_STATUS_H
+#define DRAMUTILS_UTIL_PARSE_STATUS_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace DRAMUtils::util
+{
+
+// Result of the non-throwing parse functions
+enum class ParseStatus
+{
+    Ok = 0,
+    InvalidJson,    // The input is not valid json
+    MissingId,      // The id field is missing or not a string
+    UnknownId,      // The id does not match any of the variant types
+    InvalidValue,   // The selected type could not be read from the json value
+    FileError,      // The input file could not be read
+};
+
+constexpr std::string_view to_string(ParseStatus status) noexcept
+{
+    switch (status)
+    {
+    case ParseStatus::Ok: return "Ok";
+    case ParseStatus::InvalidJson: return "InvalidJson";
+    case ParseStatus::MissingId: return "MissingId";
+    case ParseStatus::UnknownId: return "UnknownId";
+    case ParseStatus::InvalidValue: return "InvalidValue";
+    case ParseStatus::FileError: return "FileError";
+    }
+    return "Unknown";
+}
+
+// Cause of a failed parse. The strings are only built when an error occurs.
+struct ParseError
+{
+    ParseStatus status = ParseStatus::Ok;
+    std::string path;       // JSON pointer (RFC 6901) of the value that could not be read
+    std::string expected;   // Expected json type or value at path
+    std::string standard;   // Id of the variant alternative being parsed, e.g. "DDR4"
+    std::size_t position = 0; // Byte position of the syntax error for ParseStatus::InvalidJson
+
+    // e.g. "InvalidValue at /memspec/memtimingspec/RAS (DDR4): expected number"
+    std::string message() const
+    {
+        std::string result(to_string(status));
+        if (status == ParseStatus::InvalidJson)
+            return result + " at byte " + std::to_string(position);
+        if (!path.empty())
+            result += " at " + path;
+        if (!standard.empty())
+            result += " (" + standard + ")";
+        if (!expected.empty())
+            result += ": expected " + expected;
+        return result;
+    }
+};
+
+} // namespace DRAMUtils::util
+
+#endif /* DRAMUTILS_UTIL_PARSE_STATUS_H */
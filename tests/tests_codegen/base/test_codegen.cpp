@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "TestDDR4.h"
+
+using namespace DRAMUtils;
+
+// The generated timings are compile time constants
+static_assert(generated::TestDDR4::RCD == 22);
+static_assert(generated::TestDDR4::tCK == 0.625e-9);
+static_assert(generated::TestDDR4::memspec.memoryId == "Test_DDR4-3200");
+static_assert(generated::TestDDR4::memspec.memarchitecturespec.maxBurstLength == 8u);
+static_assert(generated::TestDDR4::memspec.bankwisespec->factRho == 0.5);
+
+template <typename Part>
+constexpr bool rcdSatisfied(std::uint64_t cycles)
+{
+    return cycles >= Part::RCD;
+}
+static_assert(rcdSatisfied<generated::TestDDR4>(22));
+
+TEST(Memspec_Codegen_Test, MatchesJson)
+{
+    std::ifstream file(std::filesystem::path(TEST_RESOURCE_DIR) / "ddr4.json");
+    auto memspec = parse_memspec_from_json(json_t::parse(file));
+    ASSERT_TRUE(memspec);
+
+    // Round trip through json to compare every field
+    MemSpec::MemSpecVariant generated;
+    generated.setVariant(generated::TestDDR4::memspec);
+
+    json_t expected;
+    json_t actual;
+    memspec->to_json(expected);
+    generated.to_json(actual);
+    EXPECT_EQ(expected, actual);
+}
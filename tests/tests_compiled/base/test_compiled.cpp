@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/config/toggling_rate.h"
+
+#ifdef INCLUDE_NLOHMANN_JSON_HPP_
+#error "The compiled DRAMUtils library must not expose nlohmann/json.hpp"
+#endif
+
+using namespace DRAMUtils;
+
+
+const char* test_mem_spec = R"(
+{
+    "memarchitecturespec": {
+        "burstLength": 0,
+        "dataRate": 0,
+        "nbrOfBanks": 0,
+        "nbrOfChannels": 0,
+        "nbrOfColumns": 0,
+        "nbrOfDevices": 0,
+        "nbrOfRows": 0,
+        "nbrOfRanks": 0,
+        "width": 0
+    },
+    "memoryId": "Test_DDR3",
+    "memoryType": "DDR3",
+    "memtimingspec": {
+        "ACTPDEN": 0,
+        "AL": 0,
+        "CCD": 0,
+        "CKE": 11,
+        "CKESR": 0,
+        "DQSCK": 0,
+        "FAW": 0,
+        "PRPDEN": 0,
+        "RAS": 0,
+        "RC": 0,
+        "RCD": 0,
+        "REFI": 0,
+        "REFPDEN": 0,
+        "RFC": 0,
+        "RL": 0,
+        "RP": 0,
+        "RRD": 0,
+        "RTP": 0,
+        "RTRS": 0,
+        "WL": 0,
+        "WR": 0,
+        "WTR": 0,
+        "XP": 0,
+        "XPDLL": 0,
+        "XS": 0,
+        "XSDLL": 0,
+        "tCK": 0.0
+    }
+}
+)";
+
+
+TEST(Memspec_Compiled_Test, ParseBuffer)
+{
+    auto memspec = parse_Memspec_from_buffer(test_mem_spec);
+    ASSERT_TRUE(memspec);
+
+    const auto* ddr3 = std::get_if<MemSpec::MemSpecDDR3>(&memspec->getVariant());
+    ASSERT_NE(ddr3, nullptr);
+    EXPECT_EQ(ddr3->memoryId, "Test_DDR3");
+    EXPECT_EQ(ddr3->memtimingspec.CKE, 11);
+}
+
+TEST(Memspec_Compiled_Test, ParseBufferSax)
+{
+    MemSpec::MemSpecVariant memspec;
+    ASSERT_EQ(parse_memspec_from_buffer_sax(test_mem_spec, memspec), util::ParseStatus::Ok);
+    EXPECT_TRUE(std::holds_alternative<MemSpec::MemSpecDDR3>(memspec.getVariant()));
+
+    EXPECT_EQ(parse_memspec_from_buffer_sax("{", memspec), util::ParseStatus::InvalidJson);
+    EXPECT_EQ(MemSpec::MemSpecVariant::findIndex("DDR3"), 0u);
+}
+
+TEST(Memspec_Compiled_Test, BinaryRoundTrip)
+{
+    auto memspec = parse_memspec_from_buffer_sax(test_mem_spec);
+    ASSERT_TRUE(memspec);
+
+    const auto cbor = write_memspec_to_cbor(*memspec);
+    auto result = parse_memspec_from_cbor(cbor);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<MemSpec::MemSpecDDR3>(result->getVariant()).memoryId, "Test_DDR3");
+}
@@ -0,0 +1,48 @@
+#ifndef DRAMUTILS_TESTS_MEMSPEC_FIXTURE_H
+#define DRAMUTILS_TESTS_MEMSPEC_FIXTURE_H
+
+#include <string>
+#include <utility>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+// Shared MemSpec builders for the tests
+namespace DRAMUtils::test
+{
+
+// Value initialized MemSpec of the standard T with a test id and a 1.6 GHz clock
+template <typename T>
+T createStandard(const std::string& memoryId = "Test_" + std::string(T::id))
+{
+    T memspec{};
+    memspec.memoryId = memoryId;
+    memspec.memtimingspec.tCK = 625e-12;
+    return memspec;
+}
+
+template <typename T>
+MemSpec::MemSpecVariant makeVariant(T&& memspec)
+{
+    MemSpec::MemSpecVariant variant;
+    variant.setVariant(std::forward<T>(memspec));
+    return variant;
+}
+
+template <typename T>
+MemSpec::MemSpecVariant createMemSpec(const std::string& memoryId = "Test_" + std::string(T::id))
+{
+    return makeVariant(createStandard<T>(memoryId));
+}
+
+// The MemSpec in its json container {"memspec": ...}
+inline json_t memspecJson(const MemSpec::MemSpecVariant& memspec)
+{
+    json_t j;
+    j["memspec"] = memspec;
+    return j;
+}
+
+} // namespace DRAMUtils::test
+
+#endif /* DRAMUTILS_TESTS_MEMSPEC_FIXTURE_H */
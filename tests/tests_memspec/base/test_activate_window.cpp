@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+static_assert(sizeof(MemSpec::ActivateWindow<>) <= 64);
+
+TEST(Memspec_ActivateWindow_Test, Window)
+{
+    MemSpec::ActivateWindow<> window(20);
+    EXPECT_EQ(window.window(), 20u);
+    EXPECT_EQ(window.earliestNextAct(), 0u);
+
+    window.activate(0);
+    window.activate(4);
+    window.activate(8);
+    EXPECT_EQ(window.earliestNextAct(), 0u);
+    window.activate(12);
+    EXPECT_EQ(window.earliestNextAct(), 20u);
+    window.activate(20);
+    EXPECT_EQ(window.earliestNextAct(), 24u);
+
+    window.reset();
+    EXPECT_EQ(window.earliestNextAct(), 0u);
+}
+
+TEST(Memspec_ActivateWindow_Test, Unconstrained)
+{
+    MemSpec::ActivateWindow<> window;
+    for (std::uint64_t time = 100; time < 110; ++time)
+        window.activate(time);
+    EXPECT_EQ(window.earliestNextAct(), 0u);
+}
+
+TEST(Memspec_ActivateWindow_Test, Capacity)
+{
+    MemSpec::ActivateWindow<8> window(40);
+    for (std::uint64_t time = 0; time < 8; ++time)
+        window.activate(time * 2);
+    EXPECT_EQ(window.earliestNextAct(), 40u);
+    window.activate(16);
+    EXPECT_EQ(window.earliestNextAct(), 42u);
+}
+
+TEST(Memspec_ActivateWindow_Test, Standards)
+{
+    MemSpec::MemSpecLPDDR4 lpddr4{};
+    lpddr4.memtimingspec.FAW = 32;
+    EXPECT_EQ(MemSpec::make_activate_window(lpddr4).window(), 32u);
+
+    MemSpec::MemSpecDDR4 ddr4{};
+    ddr4.memtimingspec.FAW = 20;
+    EXPECT_EQ(MemSpec::make_activate_window(ddr4).window(), 20u);
+}
+
+TEST(Memspec_ActivateWindow_Test, LogicalRanks)
+{
+    MemSpec::MemSpecDDR5 memspec{};
+    memspec.memarchitecturespec.nbrOfLogicalRanks = 2;
+    memspec.memtimingspec.FAW_slr = 32;
+    memspec.memtimingspec.FAW_dlr = 16;
+
+    auto window = MemSpec::make_activate_window(memspec);
+    ASSERT_EQ(window.logicalRanks(), 2u);
+
+    for (std::uint64_t time = 0; time < 4; ++time)
+        window.activate(0, time * 2);
+    EXPECT_EQ(window.earliestNextAct(0), 32u);
+    EXPECT_EQ(window.earliestNextAct(1), 16u);
+
+    window.activate(1, 16);
+    window.activate(1, 18);
+    EXPECT_EQ(window.earliestNextAct(1), 20u);
+    EXPECT_EQ(window.earliestNextAct(0), 32u);
+
+    window.reset();
+    EXPECT_EQ(window.earliestNextAct(0), 0u);
+
+    EXPECT_THROW(MemSpec::LogicalRankActivateWindow(0, 32, 16), std::invalid_argument);
+}
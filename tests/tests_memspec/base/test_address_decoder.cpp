@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "DRAMUtils/config/address_decoder.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+class Address_Decoder_Test : public ::testing::Test
+{
+protected:
+    MemSpec::MemArchitectureSpecTypeDDR4 spec{};
+    Config::AddressMapping mapping;
+
+    void SetUp() override
+    {
+        // 1 channel, 2 ranks, 4 bank groups with 4 banks, 64k rows, 1k columns, 8 byte bus
+        spec.nbrOfChannels = 1;
+        spec.nbrOfRanks = 2;
+        spec.nbrOfBankGroups = 4;
+        spec.nbrOfBanks = 16;
+        spec.nbrOfRows = 65536;
+        spec.nbrOfColumns = 1024;
+
+        mapping.BYTE_BIT = {{0, 1, 2}};
+        mapping.COLUMN_BIT = {{3, 4, 5, 6, 7, 8, 9, 10, 11, 12}};
+        mapping.BANKGROUP_BIT = {{13, 14}};
+        mapping.BANK_BIT = {{15, 16}};
+        mapping.ROW_BIT = std::vector<unsigned>{};
+        for (unsigned bit = 17; bit < 33; ++bit)
+            mapping.ROW_BIT->push_back(bit);
+        mapping.RANK_BIT = {{33}};
+    }
+
+    // Bit by bit reference
+    static std::uint64_t gather(std::uint64_t address, const std::optional<std::vector<unsigned>>& bits)
+    {
+        std::uint64_t value = 0;
+        if (bits)
+            for (std::size_t i = 0; i < bits->size(); ++i)
+                value |= ((address >> (*bits)[i]) & 1) << i;
+        return value;
+    }
+
+    void compareWithReference(const Config::AddressDecoder& decoder)
+    {
+        std::mt19937_64 gen(7);
+        std::vector<std::uint64_t> addresses(1000);
+        for (auto& address : addresses)
+            address = gen() & ((std::uint64_t{1} << 34) - 1);
+
+        std::vector<Config::DecodedAddress> decoded(addresses.size());
+        decoder.decode(addresses.data(), decoded.data(), addresses.size());
+        for (std::size_t i = 0; i < addresses.size(); ++i)
+        {
+            ASSERT_EQ(decoded[i].channel, 0u);
+            ASSERT_EQ(decoded[i].rank, gather(addresses[i], mapping.RANK_BIT));
+            ASSERT_EQ(decoded[i].bankGroup, gather(addresses[i], mapping.BANKGROUP_BIT));
+            ASSERT_EQ(decoded[i].bank, gather(addresses[i], mapping.BANK_BIT));
+            ASSERT_EQ(decoded[i].row, gather(addresses[i], mapping.ROW_BIT));
+            ASSERT_EQ(decoded[i].column, gather(addresses[i], mapping.COLUMN_BIT));
+            ASSERT_EQ(decoded[i].byte, gather(addresses[i], mapping.BYTE_BIT));
+        }
+    }
+};
+
+TEST_F(Address_Decoder_Test, Decode)
+{
+    Config::AddressDecoder decoder(mapping, spec);
+    EXPECT_EQ(decoder.mask(Config::AddressField::BankGroup), 0x6000u);
+
+    const auto decoded = decoder.decode((std::uint64_t{1} << 33) | (3u << 15) | (2u << 13) | (5u << 3) | 7u);
+    EXPECT_EQ(decoded.rank, 1u);
+    EXPECT_EQ(decoded.bank, 3u);
+    EXPECT_EQ(decoded.bankGroup, 2u);
+    EXPECT_EQ(decoded.row, 0u);
+    EXPECT_EQ(decoded.column, 5u);
+    EXPECT_EQ(decoded.byte, 7u);
+
+    compareWithReference(decoder);
+}
+
+TEST_F(Address_Decoder_Test, Unordered)
+{
+    // Descending row bits and interleaved bank bits cannot use PEXT
+    std::reverse(mapping.ROW_BIT->begin(), mapping.ROW_BIT->end());
+    mapping.BANKGROUP_BIT = {{15, 13}};
+    mapping.BANK_BIT = {{14, 16}};
+
+    Config::AddressDecoder decoder(mapping, spec);
+    EXPECT_FALSE(decoder.usesPext());
+    compareWithReference(decoder);
+}
+
+TEST_F(Address_Decoder_Test, FromJson)
+{
+    const json_t j = mapping;
+    const auto parsed = j.get<Config::AddressMapping>();
+    EXPECT_EQ(parsed.ROW_BIT, mapping.ROW_BIT);
+    EXPECT_FALSE(parsed.CHANNEL_BIT);
+    compareWithReference(Config::AddressDecoder(parsed, spec));
+}
+
+TEST_F(Address_Decoder_Test, Invalid)
+{
+    auto duplicate = mapping;
+    duplicate.RANK_BIT = {{0}};
+    EXPECT_THROW(Config::AddressDecoder(duplicate, spec), std::invalid_argument);
+
+    auto outOfRange = mapping;
+    outOfRange.RANK_BIT = {{64}};
+    EXPECT_THROW(Config::AddressDecoder(outOfRange, spec), std::invalid_argument);
+
+    // Only 8 rows
+    auto geometry = Config::make_address_geometry(spec);
+    geometry.rows = 8;
+    EXPECT_THROW(Config::AddressDecoder(mapping, geometry), std::invalid_argument);
+}
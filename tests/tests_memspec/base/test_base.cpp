@@ -173,4 +173,43 @@ TEST_F(Memspec_Base_Test, ParseMemSpec_Invalid)
     json_t invalid_spec = test_container;
     invalid_spec["memspec"]["memarchitecturespec"].erase("nbrOfRows");
     ASSERT_FALSE(DRAMUtils::parse_memspec_from_json(invalid_spec));
-}
\ No newline at end of file
+}
+TEST_F(Memspec_Base_Test, ParseMemSpec_Status)
+{
+    // Test data
+    json_t test_json = test_container;
+    MemSpec::MemSpecVariant result;
+
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_json(test_json, result), util::ParseStatus::Ok);
+    compareMemSpec(result);
+
+    // Missing id field
+    json_t missing_id = test_container;
+    missing_id["memspec"].erase("memoryType");
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_json(missing_id, result), util::ParseStatus::MissingId);
+
+    // Unknown id
+    json_t unknown_id = test_container;
+    unknown_id["memspec"]["memoryType"] = "DDR7";
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_json(unknown_id, result), util::ParseStatus::UnknownId);
+
+    // Invalid memspec
+    json_t invalid_spec = test_container;
+    invalid_spec["memspec"]["memarchitecturespec"].erase("nbrOfRows");
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_json(invalid_spec, result), util::ParseStatus::InvalidValue);
+
+    // Buffer
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_buffer_sax(test_mem_spec, result), util::ParseStatus::Ok);
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_buffer_sax("{", result), util::ParseStatus::InvalidJson);
+    ASSERT_EQ(DRAMUtils::parse_memspec_from_buffer_sax(invalid_spec.dump(), result), util::ParseStatus::InvalidValue);
+}
+
+TEST_F(Memspec_Base_Test, IDVariant_FindIndex)
+{
+    using Variant = MemSpec::MemSpecVariant;
+    ASSERT_EQ(Variant::findIndex(MemSpec::MemSpecDDR3::id), 0);
+    ASSERT_EQ(Variant::findIndex(MemSpec::MemSpecDDR5::id), 2);
+    ASSERT_EQ(Variant::findIndex(MemSpec::MemSpecSTTMRAM::id), 12);
+    ASSERT_FALSE(Variant::findIndex("DDR"));
+    ASSERT_FALSE(Variant::findIndex(""));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_Binary_Test : public ::testing::Test
+{
+protected:
+    MemSpec::MemSpecVariant createMemSpec()
+    {
+        auto memspec = test::createStandard<MemSpec::MemSpecDDR5>();
+        memspec.memarchitecturespec.nbrOfRows = 65536;
+        memspec.memtimingspec.RCD = 39;
+        memspec.mempowerspec.idd0 = 0.061;
+        return test::makeVariant(memspec);
+    }
+
+    void compareMemSpec(const MemSpec::MemSpecVariant& variant)
+    {
+        const auto& memspec = std::get<MemSpec::MemSpecDDR5>(variant.getVariant());
+        ASSERT_EQ(memspec.memoryId, "Test_DDR5");
+        ASSERT_EQ(memspec.memarchitecturespec.nbrOfRows, 65536);
+        ASSERT_EQ(memspec.memtimingspec.tCK, 625e-12);
+        ASSERT_EQ(memspec.memtimingspec.RCD, 39);
+        ASSERT_EQ(memspec.mempowerspec.idd0, 0.061);
+    }
+
+    void writeFile(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+
+    virtual void SetUp()
+    {
+        directory = std::filesystem::temp_directory_path() / "dramutils_test_binary";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    virtual void TearDown()
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::filesystem::path directory;
+};
+
+TEST_F(Memspec_Binary_Test, RoundTrip)
+{
+    const auto memspec = createMemSpec();
+
+    auto cbor = parse_memspec_from_cbor(write_memspec_to_cbor(memspec));
+    ASSERT_TRUE(cbor);
+    compareMemSpec(*cbor);
+
+    auto msgpack = parse_memspec_from_msgpack(write_memspec_to_msgpack(memspec));
+    ASSERT_TRUE(msgpack);
+    compareMemSpec(*msgpack);
+
+    // Without key
+    auto no_key = parse_memspec_from_cbor(write_memspec_to_cbor(memspec, ""), "");
+    ASSERT_TRUE(no_key);
+    compareMemSpec(*no_key);
+
+    // Invalid data
+    ASSERT_FALSE(parse_memspec_from_cbor({}));
+    ASSERT_FALSE(parse_memspec_from_msgpack(write_memspec_to_cbor(memspec)));
+    auto truncated = write_memspec_to_cbor(memspec);
+    truncated.resize(truncated.size() / 2);
+    ASSERT_FALSE(parse_memspec_from_cbor(truncated));
+}
+
+TEST_F(Memspec_Binary_Test, Cache)
+{
+    const auto path = directory / "memspec.json";
+    const auto cache = directory / "memspec.json.cbor";
+
+    json_t j;
+    j["memspec"] = createMemSpec();
+    writeFile(path, j.dump(4));
+
+    // First parse creates the cache
+    auto first = parse_memspec_from_file_cached(path);
+    ASSERT_TRUE(first);
+    compareMemSpec(*first);
+    ASSERT_TRUE(std::filesystem::exists(cache));
+
+    // Second parse reads the cache
+    auto second = parse_memspec_from_file_cached(path);
+    ASSERT_TRUE(second);
+    compareMemSpec(*second);
+
+    // Changed source invalidates the cache
+    j["memspec"]["memoryId"] = "Changed_DDR5";
+    writeFile(path, j.dump(4));
+    auto changed = parse_memspec_from_file_cached(path);
+    ASSERT_TRUE(changed);
+    ASSERT_EQ(std::get<MemSpec::MemSpecDDR5>(changed->getVariant()).memoryId, "Changed_DDR5");
+
+    // Corrupt cache falls back to the source
+    writeFile(cache, "corrupt");
+    auto corrupt = parse_memspec_from_file_cached(path);
+    ASSERT_TRUE(corrupt);
+    ASSERT_EQ(std::get<MemSpec::MemSpecDDR5>(corrupt->getVariant()).memoryId, "Changed_DDR5");
+
+    // MessagePack cache
+    ASSERT_TRUE(parse_memspec_from_file_cached(path, "memspec", BinaryFormat::MessagePack));
+    ASSERT_TRUE(std::filesystem::exists(directory / "memspec.json.msgpack"));
+
+    // Missing file
+    ASSERT_FALSE(parse_memspec_from_file_cached(directory / "missing.json"));
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+#include "DRAMUtils/memspec/MemSpecCatalogue.h"
+
+using namespace DRAMUtils;
+
+namespace Catalogue = MemSpec::Catalogue;
+
+static_assert(Catalogue::DDR4_3200_8Gb_x8.memtimingspec.RCD == 22);
+static_assert(Catalogue::find<MemSpec::MemSpecDDR5>("JEDEC_16Gb_DDR5-4800_4bit") == &Catalogue::DDR5_4800_16Gb_x4);
+static_assert(Catalogue::find<MemSpec::MemSpecDDR4>("JEDEC_16Gb_DDR5-4800_4bit") == nullptr);
+static_assert(Catalogue::find<MemSpec::MemSpecHBM3>("unknown") == nullptr);
+
+TEST(Memspec_Catalogue_Test, Lookup)
+{
+    auto memspec = find_builtin_memspec("JEDEC_16Gb_LPDDR5-6400_16bit");
+    ASSERT_TRUE(memspec);
+    const auto& lpddr5 = std::get<MemSpec::MemSpecLPDDR5>(memspec->getVariant());
+    EXPECT_EQ(lpddr5.memoryId, "JEDEC_16Gb_LPDDR5-6400_16bit");
+    EXPECT_EQ(lpddr5.memtimingspec.RL, 17);
+
+    EXPECT_FALSE(find_builtin_memspec("unknown"));
+}
+
+TEST(Memspec_Catalogue_Test, RoundTrip)
+{
+    auto memspec = find_builtin_memspec("JEDEC_8Gb_DDR4-3200_8bit");
+    ASSERT_TRUE(memspec);
+
+    json_t json;
+    json["memspec"] = *memspec;
+    EXPECT_EQ(json["memspec"]["memoryId"], "JEDEC_8Gb_DDR4-3200_8bit");
+
+    auto dom = parse_memspec_from_json(json);
+    auto sax = parse_memspec_from_buffer_sax(json.dump());
+    ASSERT_TRUE(dom);
+    ASSERT_TRUE(sax);
+    EXPECT_EQ(std::get<MemSpec::MemSpecDDR4>(dom->getVariant()).memoryId, Catalogue::DDR4_3200_8Gb_x8.memoryId);
+    EXPECT_EQ(std::get<MemSpec::MemSpecDDR4>(sax->getVariant()).memtimingspec.RFC1, 560);
+
+    const auto table = MemSpec::make_timing_table(Catalogue::DDR4_3200_8Gb_x8.memtimingspec);
+    EXPECT_EQ(table.ps(MemSpec::TimingConstraintDDR4::RCD), 13750u);
+}
+
+TEST(Memspec_Catalogue_Test, MemoryIdCapacity)
+{
+    json_t json;
+    json["memspec"] = *find_builtin_memspec("JEDEC_16Gb_HBM3-6400");
+    json["memspec"]["memoryId"] = std::string(MemSpec::MemoryId::capacity + 1, 'x');
+
+    MemSpec::MemSpecVariant memspec;
+    EXPECT_EQ(parse_memspec_from_json(json, memspec), util::ParseStatus::InvalidValue);
+    EXPECT_EQ(parse_memspec_from_buffer_sax(json.dump(), memspec), util::ParseStatus::InvalidValue);
+    EXPECT_THROW(json["memspec"].get<MemSpec::MemSpecHBM3>(), std::length_error);
+}
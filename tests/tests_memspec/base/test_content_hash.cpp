@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/util/content_hash.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+namespace content_hash_test
+{
+
+struct Sample
+{
+    std::string name;
+    uint64_t count;
+    double value;
+    std::optional<uint64_t> limit;
+    std::vector<int> list;
+};
+NLOHMANN_JSONIFY_ALL_THINGS(Sample, name, count, value, limit, list)
+
+} // namespace content_hash_test
+
+namespace
+{
+
+template <typename... Ts>
+void checkStandards(util::type_sequence<Ts...>)
+{
+    (
+        [] {
+            const auto memspec = test::createMemSpec<Ts>();
+            auto copy = memspec;
+            EXPECT_TRUE(copy == memspec) << Ts::id;
+            EXPECT_EQ(util::content_hash(copy), util::content_hash(memspec)) << Ts::id;
+
+            // Parsed from its json the MemSpec is still equal
+            const auto parsed = parse_memspec_from_json(test::memspecJson(memspec));
+            ASSERT_TRUE(parsed.has_value()) << Ts::id;
+            EXPECT_TRUE(*parsed == memspec) << Ts::id;
+            EXPECT_EQ(util::content_hash(*parsed), util::content_hash(memspec)) << Ts::id;
+
+            std::get<Ts>(copy.getVariant()).memtimingspec.tCK = 750e-12;
+            EXPECT_TRUE(copy != memspec) << Ts::id;
+            EXPECT_NE(util::content_hash(copy), util::content_hash(memspec)) << Ts::id;
+        }(),
+        ...);
+}
+
+} // namespace
+
+TEST(ContentHash, AllStandards)
+{
+    checkStandards(MemSpec::VariantTypes{});
+}
+
+TEST(ContentHash, DistinctStandards)
+{
+    const auto ddr4 = test::createMemSpec<MemSpec::MemSpecDDR4>();
+    const auto ddr5 = test::createMemSpec<MemSpec::MemSpecDDR5>();
+    EXPECT_TRUE(ddr4 != ddr5);
+    EXPECT_NE(util::content_hash(ddr4), util::content_hash(ddr5));
+}
+
+TEST(ContentHash, FieldWiseEquality)
+{
+    using content_hash_test::Sample;
+    const Sample sample{"a", 1, 0.5, std::nullopt, {1, 2}};
+
+    Sample other = sample;
+    EXPECT_TRUE(other == sample);
+    other.list.push_back(3);
+    EXPECT_TRUE(other != sample);
+
+    other = sample;
+    other.limit = 0;
+    EXPECT_TRUE(other != sample);
+    EXPECT_NE(util::content_hash(other), util::content_hash(sample));
+
+    // Signed zeros compare and hash equally
+    other = sample;
+    other.value = 0.0;
+    Sample negative = other;
+    negative.value = -0.0;
+    EXPECT_TRUE(negative == other);
+    EXPECT_EQ(util::content_hash(negative), util::content_hash(other));
+}
+
+TEST(ContentHash, Boundaries)
+{
+    using content_hash_test::Sample;
+    // Lengths are hashed, moving a character between strings changes the hash
+    EXPECT_NE(util::content_hash(std::vector<std::string>{"ab", "c"}),
+              util::content_hash(std::vector<std::string>{"a", "bc"}));
+    EXPECT_NE(util::content_hash(Sample{"", 0, 0.0, std::nullopt, {}}),
+              util::content_hash(Sample{"", 0, 0.0, std::nullopt, {0}}));
+    EXPECT_NE(util::content_hash(uint64_t{1}), util::content_hash(uint64_t{1}, 1));
+}
+
+TEST(ContentHash, Stable)
+{
+    // The hash must not depend on the platform or the build, it may be persisted
+    using content_hash_test::Sample;
+    EXPECT_EQ(util::content_hash(Sample{"DDR4", 8, 1.5, 16, {1, 2, 3}}), 0xBA77F20DA8D189ABull);
+}
+
+TEST(ContentHash, UnorderedSet)
+{
+    std::unordered_set<MemSpec::MemSpecVariant> set;
+    set.insert(test::createMemSpec<MemSpec::MemSpecDDR4>());
+    set.insert(test::createMemSpec<MemSpec::MemSpecDDR4>());
+    set.insert(test::createMemSpec<MemSpec::MemSpecLPDDR5>());
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_EQ(set.count(test::createMemSpec<MemSpec::MemSpecLPDDR5>()), 1u);
+}
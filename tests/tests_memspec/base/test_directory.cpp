@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_Directory_Test : public ::testing::Test
+{
+protected:
+    std::filesystem::path directory;
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "dramutils_test_directory";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory / "sub");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    template <typename MemSpecType>
+    void writeMemSpec(const std::filesystem::path& path)
+    {
+        std::ofstream(path) << test::memspecJson(test::createMemSpec<MemSpecType>()).dump();
+    }
+};
+
+TEST_F(Memspec_Directory_Test, ParseDirectory)
+{
+    writeMemSpec<MemSpec::MemSpecDDR4>(directory / "ddr4.json");
+    writeMemSpec<MemSpec::MemSpecLPDDR5>(directory / "sub" / "lpddr5.json");
+    std::ofstream(directory / "invalid.json") << "{\"memspec\": ";
+    std::ofstream(directory / "unknown.json") << R"({"memspec": {"memoryType": "DDR42"}})";
+    std::ofstream(directory / "ignored.txt") << "not a memspec";
+
+    for (std::size_t threads : {0, 1, 4})
+    {
+        const auto results = parse_memspecs_from_directory(directory, threads);
+        ASSERT_EQ(results.size(), 4);
+
+        // Results are sorted by path
+        ASSERT_EQ(results[0].path, directory / "ddr4.json");
+        ASSERT_EQ(results[0].status, util::ParseStatus::Ok);
+        ASSERT_TRUE(std::holds_alternative<MemSpec::MemSpecDDR4>(results[0].memspec.getVariant()));
+
+        ASSERT_EQ(results[1].path, directory / "invalid.json");
+        ASSERT_EQ(results[1].status, util::ParseStatus::InvalidJson);
+
+        ASSERT_EQ(results[2].path, directory / "sub" / "lpddr5.json");
+        ASSERT_EQ(results[2].status, util::ParseStatus::Ok);
+        const auto& lpddr5 = std::get<MemSpec::MemSpecLPDDR5>(results[2].memspec.getVariant());
+        ASSERT_EQ(lpddr5.memoryId, "Test_LPDDR5");
+
+        ASSERT_EQ(results[3].path, directory / "unknown.json");
+        ASSERT_EQ(results[3].status, util::ParseStatus::UnknownId);
+    }
+}
+
+TEST_F(Memspec_Directory_Test, MissingDirectory)
+{
+    ASSERT_TRUE(parse_memspecs_from_directory(directory / "missing").empty());
+    ASSERT_TRUE(parse_memspecs_from_directory(directory).empty());
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+TEST(Memspec_EnergyTable_Test, DDR4)
+{
+    MemSpec::MemSpecDDR4 memspec{};
+    auto& arch = memspec.memarchitecturespec;
+    arch.burstLength = 8;
+    arch.dataRate = 2;
+    arch.RefMode = 2;
+    auto& t = memspec.memtimingspec;
+    t.tCK = 1e-9;
+    t.RAS = 10;
+    t.RP = 5;
+    t.RFC1 = 100;
+    t.RFC2 = 50;
+    auto& p = memspec.mempowerspec;
+    p.vdd = 1.0;
+    p.idd0 = 0.05;
+    p.idd2n = 0.02;
+    p.idd3n = 0.03;
+    p.idd4r = 0.13;
+    p.idd4w = 0.11;
+    p.idd5F2 = 0.2;
+    p.idd2p = 0.01;
+    p.idd6n = 0.005;
+    p.vpp = 2.0;
+    p.ipp0 = 0.004;
+    p.ipp3n = 0.002;
+
+    const auto table = MemSpec::make_energy_table(memspec);
+    using Command = MemSpec::EnergyCommand;
+    using State = MemSpec::BackgroundState;
+
+    EXPECT_DOUBLE_EQ(table.energy(Command::ACT), (0.02 * 1.0 + 0.002 * 2.0) * 10e-9);
+    EXPECT_DOUBLE_EQ(table.energy(Command::PRE), (0.03 * 1.0 + 0.004 * 2.0) * 5e-9);
+    EXPECT_DOUBLE_EQ(table.energy(Command::RD), (0.1 * 1.0 - 0.002 * 2.0) * 4e-9);
+    EXPECT_DOUBLE_EQ(table.energy(Command::WR), (0.08 * 1.0 - 0.002 * 2.0) * 4e-9);
+    // RefMode 2 uses IDD5F2 and tRFC2
+    EXPECT_DOUBLE_EQ(table.energy(Command::REF), (0.17 * 1.0 - 0.002 * 2.0) * 50e-9);
+    EXPECT_EQ(table.energy(Command::REFPB), 0.0);
+
+    EXPECT_DOUBLE_EQ(table.power(State::PrechargeStandby), 0.02);
+    EXPECT_DOUBLE_EQ(table.power(State::ActiveStandby), 0.03 + 0.004);
+    EXPECT_DOUBLE_EQ(table.power(State::PrechargePowerDown), 0.01);
+    EXPECT_DOUBLE_EQ(table.power(State::SelfRefresh), 0.005);
+    EXPECT_DOUBLE_EQ(table.backgroundEnergy(State::PrechargeStandby, 1000), 0.02 * 1e-6);
+}
+
+TEST(Memspec_EnergyTable_Test, LPDDR5)
+{
+    MemSpec::MemSpecLPDDR5 memspec{};
+    memspec.memarchitecturespec.burstLength = 16;
+    memspec.memarchitecturespec.dataRate = 8;
+    auto& t = memspec.memtimingspec;
+    t.tCK = 1e-9;
+    t.RFCab = 20;
+    t.RFCpb = 10;
+    auto& p = memspec.mempowerspec;
+    p.vdd1 = 1.8;
+    p.vdd2h = 1.05;
+    p.vdd2l = 0.9;
+    p.idd51 = 0.01;
+    p.idd5pb2h = 0.02;
+    p.idd4r2l = 0.03;
+
+    const auto table = MemSpec::make_energy_table(memspec);
+    EXPECT_DOUBLE_EQ(table.energy(MemSpec::EnergyCommand::REF), 1.8 * 0.01 * 20e-9);
+    EXPECT_DOUBLE_EQ(table.energy(MemSpec::EnergyCommand::REFPB), 1.05 * 0.02 * 10e-9);
+    EXPECT_DOUBLE_EQ(table.energy(MemSpec::EnergyCommand::RD), 0.9 * 0.03 * 2e-9);
+    EXPECT_EQ(table.energy(MemSpec::EnergyCommand::ACT), 0.0);
+}
+
+TEST(Memspec_EnergyTable_Test, Standards)
+{
+    // Every supported standard has an overload
+    EXPECT_EQ(MemSpec::make_energy_table(MemSpec::MemSpecDDR5{}).allEnergies().size(), MemSpec::EnergyTable::commands);
+    EXPECT_EQ(MemSpec::make_energy_table(MemSpec::MemSpecLPDDR4{}).allPowers().size(), MemSpec::EnergyTable::states);
+}
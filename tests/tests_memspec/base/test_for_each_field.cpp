@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+namespace for_each_field_test
+{
+
+struct Sample
+{
+    std::string name;
+    uint64_t count = 0;
+    std::optional<double> scale;
+};
+NLOHMANN_JSONIFY_ALL_THINGS(Sample, name, count, scale)
+
+} // namespace for_each_field_test
+
+// The field list is available at compile time
+static_assert(util::field_count<for_each_field_test::Sample> == 3);
+static_assert(util::field_names<for_each_field_test::Sample>[1] == "count");
+static_assert(util::field_index<MemSpec::MemTimingSpecTypeDDR4>("tCK") == 0);
+static_assert(util::field_index<MemSpec::MemTimingSpecTypeDDR5>("RCD").has_value());
+static_assert(!util::field_index<MemSpec::MemTimingSpecTypeDDR5>("unknown").has_value());
+static_assert(util::FieldName<MemSpec::MemTimingSpecTypeDDR4, 0>::value == "tCK");
+
+TEST(ForEachField, NamesAndOrder)
+{
+    const for_each_field_test::Sample sample{"a", 2, 0.5};
+    std::vector<std::string_view> names;
+    util::for_each_field(sample, [&names](auto name, const auto& field) {
+        static_assert(std::is_same_v<decltype(name), util::FieldName<for_each_field_test::Sample, decltype(name)::index>>);
+        EXPECT_EQ(names.size(), decltype(name)::index);
+        names.emplace_back(name);
+        (void)field;
+    });
+    EXPECT_EQ(names, (std::vector<std::string_view>{"name", "count", "scale"}));
+}
+
+TEST(ForEachField, MatchesVisitJsonFields)
+{
+    // Every standard lists the same fields for for_each_field and visit_json_fields
+    MemSpec::MemSpecDDR5 memspec{};
+    std::vector<std::string_view> visited;
+    visit_json_fields(memspec.memtimingspec, [&visited](std::string_view name, const auto&) {
+        visited.push_back(name);
+        return false;
+    });
+    std::vector<std::string_view> names;
+    util::for_each_field(memspec.memtimingspec, [&names](std::string_view name, const auto&) {
+        names.push_back(name);
+    });
+    EXPECT_EQ(names, visited);
+    EXPECT_EQ(names.size(), util::field_count<MemSpec::MemTimingSpecTypeDDR5>);
+}
+
+TEST(ForEachField, CompileTimeSelection)
+{
+    MemSpec::MemTimingSpecTypeDDR4 timing{};
+    util::for_each_field(timing, [](auto name, auto& field) {
+        if constexpr (decltype(name)::value == "RCD")
+            field = 22;
+        else if constexpr (std::is_same_v<std::decay_t<decltype(field)>, uint64_t>)
+            field = 1;
+    });
+    EXPECT_EQ(timing.RCD, 22u);
+    EXPECT_EQ(timing.RP, 1u);
+    EXPECT_EQ(timing.tCK, 0.0);
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/util/json_writer.h"
+#include "DRAMUtils/config/toggling_rate.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+template <typename... Ts>
+void roundTrip(util::type_sequence<Ts...>)
+{
+    (
+        [] {
+            const auto memspec = test::createMemSpec<Ts>();
+            std::string text;
+            write_memspec_to_json(text, memspec);
+            EXPECT_EQ(json_t::parse(text), test::memspecJson(memspec)) << Ts::id;
+
+            const auto parsed = parse_Memspec_from_buffer(text);
+            ASSERT_TRUE(parsed) << Ts::id;
+            EXPECT_EQ(test::memspecJson(*parsed), test::memspecJson(memspec)) << Ts::id;
+        }(),
+        ...);
+}
+
+} // namespace
+
+TEST(Memspec_JsonWriter_Test, AllStandards)
+{
+    roundTrip(MemSpec::VariantTypes{});
+}
+
+TEST(Memspec_JsonWriter_Test, FieldOrder)
+{
+    MemSpec::MemSpecDDR5 ddr5{};
+    ddr5.memoryId = "Order";
+    ddr5.memtimingspec.tCK = 1.0;
+    ddr5.memtimingspec.RAS = 32;
+    MemSpec::MemSpecVariant memspec;
+    memspec.setVariant(ddr5);
+
+    std::string text;
+    write_memspec_to_json(text, memspec);
+    EXPECT_EQ(text.rfind(R"({"memspec":{"memoryType":"DDR5","memoryId":"Order","memarchitecturespec":{"nbrOfChannels":0,)", 0), 0u) << text;
+    EXPECT_NE(text.find(R"("memtimingspec":{"tCK":1.0,"RAS":32,)"), std::string::npos) << text;
+
+    // Absent optional fields are skipped
+    EXPECT_EQ(text.find("maxBurstLength"), std::string::npos);
+    EXPECT_EQ(text.find("bankwisespec"), std::string::npos);
+    ddr5.memarchitecturespec.maxBurstLength = 32;
+    memspec.setVariant(ddr5);
+    text.clear();
+    write_memspec_to_json(text, memspec, -1, "");
+    EXPECT_EQ(text.rfind(R"({"memoryType":"DDR5",)", 0), 0u) << text;
+    EXPECT_NE(text.find(R"("maxBurstLength":32)"), std::string::npos);
+    EXPECT_EQ(json_t::parse(text), test::memspecJson(memspec)["memspec"]);
+}
+
+TEST(Memspec_JsonWriter_Test, Indent)
+{
+    const auto memspec = test::createMemSpec<MemSpec::MemSpecLPDDR4>();
+    std::string text;
+    write_memspec_to_json(text, memspec, 4);
+    EXPECT_EQ(text.rfind("{\n    \"memspec\": {\n        \"memoryType\": \"LPDDR4\",\n", 0), 0u) << text;
+    EXPECT_EQ(text.back(), '}');
+    EXPECT_EQ(json_t::parse(text), test::memspecJson(memspec));
+
+    text.clear();
+    write_memspec_to_json(text, memspec, 0);
+    EXPECT_EQ(json_t::parse(text), test::memspecJson(memspec));
+}
+
+TEST(Memspec_JsonWriter_Test, Escape)
+{
+    MemSpec::MemSpecDDR4 ddr4{};
+    ddr4.memoryId = std::string_view("a\"b\\c\n\t\x01 d", 10);
+    MemSpec::MemSpecVariant memspec;
+    memspec.setVariant(ddr4);
+
+    std::string text;
+    write_memspec_to_json(text, memspec);
+    EXPECT_NE(text.find(R"("memoryId":"a\"b\\c\n\t\u0001 d")"), std::string::npos) << text;
+    EXPECT_EQ(json_t::parse(text), test::memspecJson(memspec));
+}
+
+TEST(Memspec_JsonWriter_Test, Enums)
+{
+    auto write = [](const auto& value) {
+        std::string text;
+        util::StringSink sink{text};
+        util::write_json(sink, value);
+        return text;
+    };
+
+    // Enums are written from their serializer table, with the same text as json_t
+    for (int mode = -1; mode <= 7; ++mode)
+    {
+        const auto pasrMode = static_cast<MemSpec::pasrModesType>(mode);
+        EXPECT_EQ(write(pasrMode), json_t(pasrMode).dump()) << mode;
+    }
+    EXPECT_EQ(write(MemSpec::pasrModesType::PASR_3), "3");
+    EXPECT_EQ(write(Config::TogglingRateIdlePattern::H), "\"H\"");
+    EXPECT_EQ(write(Config::TogglingRateIdlePattern::Invalid), "null");
+
+    // Unknown values are written as the first entry of the table
+    const auto unknown = static_cast<Config::TogglingRateIdlePattern>(42);
+    EXPECT_EQ(write(unknown), json_t(unknown).dump());
+}
+
+TEST(Memspec_JsonWriter_Test, Sinks)
+{
+    const auto memspec = test::createMemSpec<MemSpec::MemSpecHBM3>();
+    std::string text;
+    write_memspec_to_json(text, memspec, 2);
+
+    std::ostringstream stream;
+    write_memspec_to_json(stream, memspec, 2);
+    EXPECT_EQ(stream.str(), text);
+
+    std::vector<char> buffer(text.size());
+    EXPECT_EQ(write_memspec_to_json(buffer.data(), buffer.size(), memspec, 2), text.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.end()), text);
+
+    // Truncated, the full length is returned
+    std::vector<char> small(16, 'x');
+    EXPECT_EQ(write_memspec_to_json(small.data(), 8, memspec, 2), text.size());
+    EXPECT_EQ(std::string(small.begin(), small.begin() + 8), text.substr(0, 8));
+    EXPECT_EQ(small[8], 'x');
+}
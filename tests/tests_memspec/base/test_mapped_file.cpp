@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/util/mapped_file.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Mapped_File_Test : public ::testing::Test
+{
+protected:
+    std::filesystem::path directory;
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "dramutils_test_mapped_file";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+};
+
+TEST_F(Mapped_File_Test, View)
+{
+    const std::string content = "{\"memspec\": 42}";
+    std::ofstream(directory / "file.json") << content;
+
+    util::MappedFile file(directory / "file.json");
+    ASSERT_TRUE(file.isOpen());
+    ASSERT_EQ(file.isMapped(), DRAMUTILS_HAS_MMAP == 1);
+    ASSERT_EQ(file.view(), content);
+
+    // Moved from files are closed
+    util::MappedFile moved(std::move(file));
+    ASSERT_TRUE(moved.isOpen());
+    ASSERT_EQ(moved.view(), content);
+    ASSERT_FALSE(file.isOpen());
+    ASSERT_TRUE(file.view().empty());
+}
+
+TEST_F(Mapped_File_Test, Fallback)
+{
+    // Empty files cannot be mapped
+    std::ofstream(directory / "empty.json");
+    util::MappedFile empty(directory / "empty.json");
+    ASSERT_TRUE(empty.isOpen());
+    ASSERT_FALSE(empty.isMapped());
+    ASSERT_TRUE(empty.view().empty());
+
+    util::MappedFile missing(directory / "missing.json");
+    ASSERT_FALSE(missing.isOpen());
+    ASSERT_TRUE(missing.view().empty());
+
+    // Directories are no files
+    ASSERT_FALSE(util::MappedFile(directory).isOpen());
+}
+
+TEST_F(Mapped_File_Test, ParseFile)
+{
+    const auto j = test::memspecJson(test::createMemSpec<MemSpec::MemSpecDDR4>());
+    std::ofstream(directory / "ddr4.json") << j.dump(4);
+
+    ASSERT_TRUE(parse_memspec_from_file(directory / "ddr4.json"));
+    ASSERT_TRUE(parse_memspec_from_file_sax(directory / "ddr4.json"));
+    ASSERT_FALSE(parse_memspec_from_file(directory / "missing.json"));
+    ASSERT_FALSE(parse_memspec_from_file_sax(directory / "missing.json"));
+    ASSERT_FALSE(parse_memspec_from_file(directory));
+}
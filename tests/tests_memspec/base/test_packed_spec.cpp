@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+static_assert(sizeof(MemSpec::PackedMemTimingSpecTypeDDR5) <= 128);
+static_assert(sizeof(MemSpec::PackedMemTimingSpecTypeLPDDR5) <= 128);
+static_assert(sizeof(MemSpec::PackedMemTimingSpecDDR3) <= 64);
+static_assert(sizeof(MemSpec::PackedMemArchitectureSpecTypeDDR5) <= 128);
+static_assert(std::is_same_v<decltype(MemSpec::PackedMemTimingSpecTypeDDR5::RCD), uint16_t>);
+static_assert(std::is_same_v<decltype(MemSpec::PackedMemTimingSpecTypeDDR5::tCK), double>);
+static_assert(std::is_same_v<decltype(MemSpec::PackedMemArchitectureSpecTypeDDR5::nbrOfRows), uint32_t>);
+
+TEST(Memspec_PackedSpec_Test, Timing)
+{
+    MemSpec::MemTimingSpecTypeDDR5 spec{};
+    spec.tCK = 625e-12;
+    spec.RCD = 39;
+    spec.REFI1 = 6240;
+    spec.REFPDEN = 65535;
+
+    const auto packed = MemSpec::pack(spec);
+    EXPECT_EQ(packed.tCK, 625e-12);
+    EXPECT_EQ(packed.RCD, 39u);
+    EXPECT_EQ(packed.REFI1, 6240u);
+    EXPECT_EQ(packed.REFPDEN, 65535u);
+
+    const auto unpacked = MemSpec::unpack(packed);
+    EXPECT_EQ(unpacked.tCK, spec.tCK);
+    EXPECT_EQ(unpacked.RCD, spec.RCD);
+    EXPECT_EQ(unpacked.REFI1, spec.REFI1);
+    EXPECT_EQ(unpacked.REFPDEN, spec.REFPDEN);
+    EXPECT_EQ(unpacked.RAS, 0u);
+}
+
+TEST(Memspec_PackedSpec_Test, OutOfRange)
+{
+    MemSpec::MemTimingSpecTypeDDR5 spec{};
+    spec.REFI2 = 65536;
+    try
+    {
+        MemSpec::pack(spec);
+        FAIL() << "Expected std::out_of_range";
+    }
+    catch (const std::out_of_range& e)
+    {
+        EXPECT_NE(std::string(e.what()).find("REFI2"), std::string::npos);
+    }
+
+    MemSpec::MemArchitectureSpecTypeDDR5 arch{};
+    arch.nbrOfRows = uint64_t{1} << 32;
+    EXPECT_THROW(MemSpec::pack(arch), std::out_of_range);
+}
+
+TEST(Memspec_PackedSpec_Test, Architecture)
+{
+    MemSpec::MemArchitectureSpecTypeDDR5 arch{};
+    arch.nbrOfRows = 65536;
+    arch.nbrOfBanks = 32;
+
+    auto packed = MemSpec::pack(arch);
+    EXPECT_EQ(packed.nbrOfRows, 65536u);
+    EXPECT_EQ(packed.nbrOfBanks, 32u);
+    EXPECT_FALSE(MemSpec::unpack(packed).maxBurstLength);
+
+    arch.maxBurstLength = 32;
+    packed = MemSpec::pack(arch);
+    EXPECT_EQ(packed.maxBurstLength, 32u);
+    EXPECT_EQ(MemSpec::unpack(packed).maxBurstLength, 32u);
+
+    // The maximum value encodes an absent optional field
+    arch.maxBurstLength = UINT32_MAX;
+    EXPECT_THROW(MemSpec::pack(arch), std::out_of_range);
+}
+
+TEST(Memspec_PackedSpec_Test, Bool)
+{
+    MemSpec::MemArchitectureSpecTypeLPDDR5 arch{};
+    arch.WCKalwaysOn = true;
+    const auto packed = MemSpec::pack(arch);
+    EXPECT_EQ(packed.WCKalwaysOn, 1u);
+    EXPECT_TRUE(MemSpec::unpack(packed).WCKalwaysOn);
+}
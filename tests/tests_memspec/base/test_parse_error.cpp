@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_ParseError_Test : public ::testing::Test
+{
+protected:
+    json_t createMemSpecJson()
+    {
+        return test::memspecJson(test::createMemSpec<MemSpec::MemSpecDDR4>());
+    }
+
+    // Checks that the buffer and the json variant report the same error
+    util::ParseError expectError(const json_t& j)
+    {
+        const auto buffer = parse_memspec_from_buffer_checked(j.dump());
+        const auto json = parse_memspec_from_json_checked(j);
+        EXPECT_FALSE(buffer);
+        EXPECT_FALSE(json);
+        if (buffer || json)
+            return {};
+        EXPECT_EQ(buffer.error().status, json.error().status);
+        EXPECT_EQ(buffer.error().path, json.error().path);
+        EXPECT_EQ(buffer.error().expected, json.error().expected);
+        EXPECT_EQ(buffer.error().standard, json.error().standard);
+        return buffer.error();
+    }
+};
+
+TEST_F(Memspec_ParseError_Test, Ok)
+{
+    const auto j = createMemSpecJson();
+    const auto result = parse_memspec_from_buffer_checked(j.dump());
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(std::holds_alternative<MemSpec::MemSpecDDR4>(result->getVariant()));
+    ASSERT_TRUE(parse_memspec_from_json_checked(j));
+}
+
+TEST_F(Memspec_ParseError_Test, InvalidValue)
+{
+    auto j = createMemSpecJson();
+    j["memspec"]["memtimingspec"]["RAS"] = "fast";
+    const auto error = expectError(j);
+    EXPECT_EQ(error.status, util::ParseStatus::InvalidValue);
+    EXPECT_EQ(error.path, "/memspec/memtimingspec/RAS");
+    EXPECT_EQ(error.expected, "number");
+    EXPECT_EQ(error.standard, "DDR4");
+    EXPECT_EQ(error.message(), "InvalidValue at /memspec/memtimingspec/RAS (DDR4): expected number");
+}
+
+TEST_F(Memspec_ParseError_Test, MissingField)
+{
+    auto j = createMemSpecJson();
+    j["memspec"]["memarchitecturespec"].erase("nbrOfRows");
+    const auto error = expectError(j);
+    EXPECT_EQ(error.status, util::ParseStatus::InvalidValue);
+    EXPECT_EQ(error.path, "/memspec/memarchitecturespec/nbrOfRows");
+    EXPECT_EQ(error.expected, "number");
+
+    // Struct instead of a number, without container
+    auto root = createMemSpecJson()["memspec"];
+    root["memimpedancespec"] = 1;
+    const auto rootError = expectError(root);
+    EXPECT_EQ(rootError.path, "/memimpedancespec");
+    EXPECT_EQ(rootError.expected, "object");
+}
+
+TEST_F(Memspec_ParseError_Test, Id)
+{
+    auto j = createMemSpecJson();
+    j["memspec"]["memoryType"] = "DDR42";
+    const auto unknown = expectError(j);
+    EXPECT_EQ(unknown.status, util::ParseStatus::UnknownId);
+    EXPECT_EQ(unknown.path, "/memspec/memoryType");
+    EXPECT_EQ(unknown.standard, "DDR42");
+
+    j["memspec"].erase("memoryType");
+    const auto missing = expectError(j);
+    EXPECT_EQ(missing.status, util::ParseStatus::MissingId);
+    EXPECT_EQ(missing.path, "/memspec/memoryType");
+    EXPECT_EQ(missing.expected, "string");
+}
+
+TEST_F(Memspec_ParseError_Test, InvalidJson)
+{
+    const auto result = parse_memspec_from_buffer_checked("{\"memspec\": {]");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().status, util::ParseStatus::InvalidJson);
+    EXPECT_EQ(result.error().position, 14u);
+    EXPECT_EQ(result.error().message(), "InvalidJson at byte 14");
+
+    const auto file = parse_memspec_from_file_checked(std::filesystem::temp_directory_path() / "dramutils_missing.json");
+    ASSERT_FALSE(file);
+    EXPECT_EQ(file.error().status, util::ParseStatus::FileError);
+}
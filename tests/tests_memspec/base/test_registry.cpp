@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpecRegistry.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_Registry_Test : public ::testing::Test
+{
+protected:
+    std::filesystem::path directory;
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "dramutils_test_registry";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    static MemSpec::MemSpecVariant createMemSpec(const std::string& id)
+    {
+        return test::createMemSpec<MemSpec::MemSpecDDR5>(id);
+    }
+
+    std::filesystem::path writeMemSpec(const std::string& name, const std::string& id)
+    {
+        const auto path = directory / name;
+        std::ofstream(path) << test::memspecJson(createMemSpec(id)).dump();
+        return path;
+    }
+};
+
+TEST_F(Memspec_Registry_Test, Deduplication)
+{
+    MemSpec::MemSpecRegistry registry;
+    const auto a = writeMemSpec("a.json", "Test_DDR5");
+    const auto b = writeMemSpec("b.json", "Test_DDR5");
+    const auto c = writeMemSpec("c.json", "Other_DDR5");
+
+    const auto first = registry.load(a);
+    ASSERT_TRUE(first);
+    ASSERT_EQ(registry.find(a), *first);
+    ASSERT_EQ(registry.find(directory / "." / "a.json"), *first);
+    ASSERT_EQ(registry.find(b), nullptr);
+
+    // Same content from another file and from code
+    ASSERT_EQ(*registry.load(b), *first);
+    ASSERT_EQ(registry.intern(createMemSpec("Test_DDR5")), *first);
+    ASSERT_NE(*registry.load(c), *first);
+    ASSERT_EQ(registry.size(), 2u);
+
+    const auto missing = registry.load(directory / "missing.json");
+    ASSERT_FALSE(missing);
+    ASSERT_EQ(missing.error().status, util::ParseStatus::FileError);
+
+    // Handles outlive the entries
+    registry.clear();
+    ASSERT_EQ(registry.size(), 0u);
+    ASSERT_EQ(registry.find(a), nullptr);
+    ASSERT_EQ(std::get<MemSpec::MemSpecDDR5>((*first)->getVariant()).memoryId, "Test_DDR5");
+}
+
+TEST_F(Memspec_Registry_Test, Batch)
+{
+    MemSpec::MemSpecRegistry registry;
+    const auto a = writeMemSpec("a.json", "Test_DDR5");
+    const auto b = writeMemSpec("b.json", "Other_DDR5");
+    const auto c = writeMemSpec("c.json", "Test_DDR5");
+
+    const auto results = registry.load({a, b, directory / "missing.json", directory / "." / "a.json", c});
+    ASSERT_EQ(results.size(), 5u);
+    ASSERT_TRUE(results[0] && results[1] && results[3] && results[4]);
+    ASSERT_FALSE(results[2]);
+    ASSERT_EQ(results[2].error().status, util::ParseStatus::FileError);
+    ASSERT_EQ(*results[3], *results[0]);
+    ASSERT_EQ(*results[4], *results[0]);
+    ASSERT_NE(*results[1], *results[0]);
+    ASSERT_EQ(registry.size(), 2u);
+
+    // Loaded spellings and other spellings of the same file are found
+    ASSERT_EQ(registry.find(directory / "." / "a.json"), *results[0]);
+    ASSERT_EQ(registry.find(directory / "x" / ".." / "b.json"), *results[1]);
+    ASSERT_EQ(*registry.load(a), *results[0]);
+
+    std::vector<MemSpec::MemSpecVariant> memspecs;
+    memspecs.push_back(createMemSpec("Other_DDR5"));
+    memspecs.push_back(createMemSpec("New_DDR5"));
+    memspecs.push_back(createMemSpec("New_DDR5"));
+    const auto handles = registry.intern(std::move(memspecs));
+    ASSERT_EQ(handles.size(), 3u);
+    ASSERT_EQ(handles[0], *results[1]);
+    ASSERT_EQ(handles[1], handles[2]);
+    ASSERT_EQ(registry.size(), 3u);
+}
+
+TEST_F(Memspec_Registry_Test, Concurrent)
+{
+    auto& registry = MemSpec::MemSpecRegistry::instance();
+    registry.clear();
+    std::vector<std::filesystem::path> paths;
+    for (int i = 0; i < 8; ++i)
+        paths.push_back(writeMemSpec("spec" + std::to_string(i) + ".json", "Test_" + std::to_string(i % 4)));
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<MemSpec::MemSpecRegistry::Handle>> handles(8);
+    for (std::size_t t = 0; t < handles.size(); ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < 20; ++round)
+                for (const auto& path : paths)
+                    handles[t].push_back(*registry.load(path));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Every thread sees the same objects
+    ASSERT_EQ(registry.size(), 4u);
+    for (const auto& threadHandles : handles)
+    {
+        ASSERT_EQ(threadHandles.size(), handles[0].size());
+        for (std::size_t i = 0; i < threadHandles.size(); ++i)
+            ASSERT_EQ(threadHandles[i], handles[0][i]);
+    }
+    registry.clear();
+}
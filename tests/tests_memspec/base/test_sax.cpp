@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_Sax_Test : public ::testing::Test
+{
+protected:
+    // Test util functions
+    template <typename MemSpecType>
+    json_t createMemSpecJson()
+    {
+        auto memspec = test::createStandard<MemSpecType>();
+        memspec.memarchitecturespec.nbrOfRows = 10;
+        memspec.memtimingspec.RAS = 42;
+        return test::memspecJson(test::makeVariant(memspec));
+    }
+
+    void compareWithDom(const json_t& j, std::string_view key = "memspec")
+    {
+        auto dom = parse_memspec_from_json(j, key);
+        auto sax = parse_memspec_from_buffer_sax(j.dump(), key);
+        ASSERT_EQ(dom.has_value(), sax.has_value());
+        if (dom)
+        {
+            ASSERT_EQ(test::memspecJson(*dom), test::memspecJson(*sax));
+        }
+    }
+};
+
+TEST_F(Memspec_Sax_Test, MatchesDom)
+{
+    compareWithDom(createMemSpecJson<MemSpec::MemSpecDDR4>());
+    compareWithDom(createMemSpecJson<MemSpec::MemSpecDDR5>());
+    compareWithDom(createMemSpecJson<MemSpec::MemSpecLPDDR4>());
+    compareWithDom(createMemSpecJson<MemSpec::MemSpecLPDDR5>());
+    compareWithDom(createMemSpecJson<MemSpec::MemSpecHBM3>());
+
+    // Memspec without container
+    compareWithDom(createMemSpecJson<MemSpec::MemSpecDDR5>()["memspec"]);
+
+    // Optional fields
+    auto j = createMemSpecJson<MemSpec::MemSpecDDR5>();
+    j["memspec"]["bankwisespec"]["factRho"] = 0.5;
+    j["memspec"]["memarchitecturespec"]["maxBurstLength"] = 32;
+    compareWithDom(j);
+    auto sax = parse_memspec_from_buffer_sax(j.dump());
+    ASSERT_TRUE(sax);
+    const auto& ddr5 = std::get<MemSpec::MemSpecDDR5>(sax->getVariant());
+    ASSERT_EQ(ddr5.memarchitecturespec.maxBurstLength, 32);
+    ASSERT_EQ(ddr5.bankwisespec->factRho, 0.5);
+    ASSERT_EQ(ddr5.memtimingspec.RAS, 42);
+
+    // Unknown fields are ignored
+    j["memspec"]["memtimingspec"]["unknown"] = {{"a", {1, 2, 3}}};
+    compareWithDom(j);
+}
+
+TEST_F(Memspec_Sax_Test, MemoryTypeOrder)
+{
+    // memoryType after the standard specific fields
+    const char* spec = R"({"memspec": {"memarchitecturespec": {"burstLength": 8, "dataRate": 2,
+        "nbrOfBanks": 8, "nbrOfChannels": 1, "nbrOfColumns": 1024, "nbrOfDevices": 1,
+        "nbrOfRows": 10, "nbrOfRanks": 1, "width": 8}, "memoryId": "Test_DDR3",
+        "memtimingspec": {"ACTPDEN": 0, "AL": 0, "CCD": 0, "CKE": 11, "CKESR": 0, "DQSCK": 0,
+        "FAW": 0, "PRPDEN": 0, "RAS": 0, "RC": 0, "RCD": 0, "REFI": 0, "REFPDEN": 0, "RFC": 0,
+        "RL": 0, "RP": 0, "RRD": 0, "RTP": 0, "RTRS": 0, "WL": 0, "WR": 0, "WTR": 0, "XP": 0,
+        "XPDLL": 0, "XS": 0, "XSDLL": 0, "tCK": 1.25}, "memoryType": "DDR3"}})";
+
+    auto sax = parse_memspec_from_buffer_sax(spec);
+    ASSERT_TRUE(sax);
+    const auto& ddr3 = std::get<MemSpec::MemSpecDDR3>(sax->getVariant());
+    ASSERT_EQ(ddr3.memoryId, "Test_DDR3");
+    ASSERT_EQ(ddr3.memarchitecturespec.nbrOfRows, 10);
+    ASSERT_EQ(ddr3.memtimingspec.CKE, 11);
+    ASSERT_EQ(ddr3.memtimingspec.tCK, 1.25);
+}
+
+TEST_F(Memspec_Sax_Test, Invalid)
+{
+    auto j = createMemSpecJson<MemSpec::MemSpecDDR5>();
+
+    // Invalid buffers
+    ASSERT_FALSE(parse_memspec_from_buffer_sax(""));
+    ASSERT_FALSE(parse_memspec_from_buffer_sax("[1, 2]"));
+    ASSERT_FALSE(parse_memspec_from_buffer_sax(j.dump().substr(0, 100)));
+
+    // Wrong and empty key
+    compareWithDom(j, "MemSpeck");
+    compareWithDom(j, "");
+
+    // Missing required field
+    auto missing = j;
+    missing["memspec"]["memtimingspec"].erase("RCD");
+    compareWithDom(missing);
+    ASSERT_FALSE(parse_memspec_from_buffer_sax(missing.dump()));
+
+    // Wrong field type
+    auto wrong_type = j;
+    wrong_type["memspec"]["memtimingspec"]["RCD"] = "16";
+    compareWithDom(wrong_type);
+    ASSERT_FALSE(parse_memspec_from_buffer_sax(wrong_type.dump()));
+
+    // Unknown memory type
+    auto unknown = j;
+    unknown["memspec"]["memoryType"] = "DDR7";
+    compareWithDom(unknown);
+    ASSERT_FALSE(parse_memspec_from_buffer_sax(unknown.dump()));
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpecSnapshot.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_Snapshot_Test : public ::testing::Test
+{
+protected:
+    std::filesystem::path directory;
+    std::filesystem::path path;
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "dramutils_test_snapshot";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        path = directory / "memspec.snapshot";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    template <typename... Ts>
+    void roundTrip(util::type_sequence<Ts...>)
+    {
+        (
+            [this] {
+                const auto memspec = test::createMemSpec<Ts>();
+                ASSERT_TRUE(MemSpec::write_memspec_snapshot(path, memspec)) << Ts::id;
+                const auto snapshot = MemSpec::MemSpecSnapshot::open(path);
+                ASSERT_TRUE(snapshot) << Ts::id << ": " << snapshot.error().message();
+                EXPECT_EQ(snapshot->standard(), Ts::id);
+                ASSERT_NE(snapshot->template get<Ts>(), nullptr) << Ts::id;
+                EXPECT_EQ(snapshot->template get<Ts>()->memoryId, std::get<Ts>(memspec.getVariant()).memoryId);
+                EXPECT_TRUE(snapshot->memspec() == memspec) << Ts::id;
+            }(),
+            ...);
+    }
+
+    void corrupt(std::size_t offset, const void* data, std::size_t size)
+    {
+        std::vector<char> buffer = MemSpec::make_memspec_snapshot(test::createMemSpec<MemSpec::MemSpecDDR4>());
+        std::memcpy(buffer.data() + offset, data, size);
+        std::ofstream(path, std::ios::binary).write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+};
+
+TEST_F(Memspec_Snapshot_Test, AllStandards)
+{
+    roundTrip(MemSpec::VariantTypes{});
+}
+
+TEST_F(Memspec_Snapshot_Test, InPlaceAccess)
+{
+    auto memspec = test::createMemSpec<MemSpec::MemSpecDDR5>();
+    std::get<MemSpec::MemSpecDDR5>(memspec.getVariant()).memtimingspec.RCD = 39;
+    ASSERT_TRUE(MemSpec::write_memspec_snapshot(path, memspec));
+
+    const auto snapshot = MemSpec::MemSpecSnapshot::open(path);
+    ASSERT_TRUE(snapshot);
+    EXPECT_EQ(snapshot->get<MemSpec::MemSpecDDR4>(), nullptr);
+    const auto* ddr5 = snapshot->get<MemSpec::MemSpecDDR5>();
+    ASSERT_NE(ddr5, nullptr);
+    EXPECT_EQ(ddr5->memtimingspec.RCD, 39u);
+    EXPECT_EQ(snapshot->visit([](const auto& standard) { return standard.memtimingspec.tCK; }), 625e-12);
+}
+
+TEST_F(Memspec_Snapshot_Test, SchemaHash)
+{
+    EXPECT_EQ(MemSpec::snapshot_schema_hash<MemSpec::MemSpecDDR4>(), MemSpec::snapshot_schema_hash<MemSpec::MemSpecDDR4>());
+    EXPECT_NE(MemSpec::snapshot_schema_hash<MemSpec::MemSpecDDR4>(), MemSpec::snapshot_schema_hash<MemSpec::MemSpecDDR5>());
+    // GDDR5 and GDDR5X share the layout but not the id
+    EXPECT_NE(MemSpec::snapshot_schema_hash<MemSpec::MemSpecGDDR5>(), MemSpec::snapshot_schema_hash<MemSpec::MemSpecGDDR5X>());
+}
+
+TEST_F(Memspec_Snapshot_Test, Errors)
+{
+    auto status = [this] {
+        const auto snapshot = MemSpec::MemSpecSnapshot::open(path);
+        return snapshot ? util::ParseStatus::Ok : snapshot.error().status;
+    };
+    EXPECT_EQ(status(), util::ParseStatus::FileError);
+
+    std::ofstream(path) << "DUMS";
+    EXPECT_EQ(status(), util::ParseStatus::InvalidValue);
+
+    const std::uint32_t version = 2;
+    corrupt(offsetof(MemSpec::SnapshotHeader, version), &version, sizeof(version));
+    EXPECT_EQ(status(), util::ParseStatus::InvalidValue);
+
+    const std::uint64_t schema = 0;
+    corrupt(offsetof(MemSpec::SnapshotHeader, schemaHash), &schema, sizeof(schema));
+    EXPECT_EQ(status(), util::ParseStatus::InvalidValue);
+
+    corrupt(offsetof(MemSpec::SnapshotHeader, standard), "DDR9", 4);
+    EXPECT_EQ(status(), util::ParseStatus::UnknownId);
+
+    // Truncated payload
+    std::vector<char> buffer = MemSpec::make_memspec_snapshot(test::createMemSpec<MemSpec::MemSpecDDR4>());
+    std::ofstream(path, std::ios::binary).write(buffer.data(), static_cast<std::streamsize>(buffer.size() - 8));
+    EXPECT_EQ(status(), util::ParseStatus::InvalidValue);
+}
+
+TEST_F(Memspec_Snapshot_Test, InvalidValues)
+{
+    auto offset = [](const auto& object, const auto& member) {
+        return static_cast<std::size_t>(reinterpret_cast<const char*>(&member) - reinterpret_cast<const char*>(&object));
+    };
+    auto open = [this](const MemSpec::MemSpecVariant& memspec, std::size_t offset, const void* data, std::size_t size) {
+        std::vector<char> buffer = MemSpec::make_memspec_snapshot(memspec);
+        std::memcpy(buffer.data() + MemSpec::detail::snapshot_payload_offset + offset, data, size);
+        std::ofstream(path, std::ios::binary).write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        return MemSpec::MemSpecSnapshot::open(path);
+    };
+    auto invalidPath = [](const MemSpec::MemSpecSnapshot::OpenResult& result) {
+        EXPECT_FALSE(result);
+        if (result)
+            return std::string();
+        EXPECT_EQ(result.error().status, util::ParseStatus::InvalidValue);
+        return result.error().path;
+    };
+    const unsigned char one = 1;
+    const unsigned char two = 2;
+
+    // Bools
+    const auto lpddr5 = test::createMemSpec<MemSpec::MemSpecLPDDR5>();
+    const auto& standard5 = std::get<MemSpec::MemSpecLPDDR5>(lpddr5.getVariant());
+    const std::size_t wck = offset(standard5, standard5.memarchitecturespec.WCKalwaysOn);
+    EXPECT_TRUE(open(lpddr5, wck, &one, 1));
+    EXPECT_EQ(invalidPath(open(lpddr5, wck, &two, 1)), "/memarchitecturespec/WCKalwaysOn");
+
+    // Enums and engaged flags of optionals
+    auto lpddr4 = test::createMemSpec<MemSpec::MemSpecLPDDR4>();
+    auto& standard4 = std::get<MemSpec::MemSpecLPDDR4>(lpddr4.getVariant());
+    standard4.bankwisespec.emplace().pasrMode = MemSpec::pasrModesType::PASR_3;
+    ASSERT_TRUE(MemSpec::write_memspec_snapshot(path, lpddr4));
+    const auto valid = MemSpec::MemSpecSnapshot::open(path);
+    ASSERT_TRUE(valid);
+    EXPECT_EQ(valid->get<MemSpec::MemSpecLPDDR4>()->bankwisespec->pasrMode, MemSpec::pasrModesType::PASR_3);
+
+    const auto pasrMode = static_cast<MemSpec::pasrModesType>(42);
+    const std::size_t pasr = offset(standard4, *standard4.bankwisespec->pasrMode);
+    EXPECT_EQ(invalidPath(open(lpddr4, pasr, &pasrMode, sizeof(pasrMode))), "/bankwisespec/pasrMode");
+    const std::size_t hasPASR = offset(standard4, standard4.bankwisespec->hasPASR) +
+                                MemSpec::detail::optional_flag_offset<std::optional<bool>>();
+    EXPECT_TRUE(open(lpddr4, hasPASR, &one, 1));
+    EXPECT_EQ(invalidPath(open(lpddr4, hasPASR, &two, 1)), "/bankwisespec/hasPASR");
+
+    // Strings beyond their capacity
+    // The size is the last member of FixedString
+    const std::size_t size = MemSpec::MemoryId::capacity + 1;
+    const std::size_t memoryIdSize = offset(standard4, standard4.memoryId) + sizeof(MemSpec::MemoryId) - sizeof(size);
+    EXPECT_EQ(invalidPath(open(lpddr4, memoryIdSize, &size, sizeof(size))), "/memoryId");
+}
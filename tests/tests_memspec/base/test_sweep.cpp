@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "DRAMUtils/memspec/MemSpecSweep.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+MemSpec::MemSpecVariant createBase()
+{
+    auto memspec = test::createStandard<MemSpec::MemSpecDDR5>("Sweep_DDR5");
+    memspec.memtimingspec.RCD = 39;
+    memspec.memtimingspec.RP = 39;
+    memspec.mempowerspec.idd4r = 0.5;
+    return test::makeVariant(memspec);
+}
+
+const MemSpec::MemSpecDDR5& ddr5(const MemSpec::MemSpecVariant& memspec)
+{
+    return std::get<MemSpec::MemSpecDDR5>(memspec.getVariant());
+}
+
+} // namespace
+
+TEST(MemSpecSweep, CartesianProduct)
+{
+    const MemSpec::MemSpecSweep sweep(createBase(), {
+        {"memtimingspec.RCD", {30, 40}},
+        MemSpec::MemSpecSweep::Range::linear("memarchitecturespec.nbrOfBanks", 16, 32, 8),
+        {"mempowerspec.idd4r", {0.25}},
+    });
+    EXPECT_EQ(sweep.dimensions(), 3u);
+    EXPECT_EQ(sweep.size(), 6u);
+
+    std::vector<std::pair<uint64_t, uint64_t>> visited;
+    std::size_t index = 0;
+    for (auto it = sweep.begin(); it != sweep.end(); ++it, ++index)
+    {
+        EXPECT_EQ(it.index(), index);
+        const auto& memspec = ddr5(*it);
+        visited.emplace_back(memspec.memtimingspec.RCD, memspec.memarchitecturespec.nbrOfBanks);
+        EXPECT_EQ(memspec.mempowerspec.idd4r, 0.25);
+        // Untouched fields keep the value of the base
+        EXPECT_EQ(memspec.memtimingspec.RP, 39u);
+        EXPECT_EQ(memspec.memoryId, "Sweep_DDR5");
+        EXPECT_TRUE(*it == sweep.at(index));
+    }
+    EXPECT_EQ(visited, (std::vector<std::pair<uint64_t, uint64_t>>{
+        {30, 16}, {30, 24}, {30, 32}, {40, 16}, {40, 24}, {40, 32}}));
+
+    // The base is not modified
+    EXPECT_EQ(ddr5(sweep.base()).memtimingspec.RCD, 39u);
+}
+
+TEST(MemSpecSweep, NoRanges)
+{
+    const MemSpec::MemSpecSweep sweep(createBase(), {});
+    EXPECT_EQ(sweep.size(), 1u);
+    EXPECT_TRUE(*sweep.begin() == createBase());
+    EXPECT_TRUE(++sweep.begin() == sweep.end());
+}
+
+TEST(MemSpecSweep, OptionalFields)
+{
+    // Absent optional structs are value initialized
+    const MemSpec::MemSpecSweep sweep(createBase(), {{"bankwisespec.factRho", {0.5}}});
+    const auto memspec = sweep.at(0);
+    ASSERT_TRUE(ddr5(memspec).bankwisespec.has_value());
+    EXPECT_EQ(ddr5(memspec).bankwisespec->factRho, 0.5);
+}
+
+TEST(MemSpecSweep, InvalidRanges)
+{
+    using Sweep = MemSpec::MemSpecSweep;
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec.unknown", {1}}}), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec", {1}}}), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {{"memoryId", {1}}}), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec.RCD.value", {1}}}), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec.RCD", {}}}), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec.RCD", {1.5}}}), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec.RCD", {-1}}}), std::invalid_argument);
+    // 2^64 does not fit into uint64_t, the largest double below it does
+    EXPECT_THROW(Sweep(createBase(), {{"memtimingspec.RCD", {0x1p64}}}), std::invalid_argument);
+    EXPECT_NO_THROW(Sweep(createBase(), {{"memtimingspec.RCD", {0x1p64 - 2048}}}));
+    EXPECT_THROW(Sweep::Range::linear("memtimingspec.RCD", 10, 0, 1), std::invalid_argument);
+    EXPECT_THROW(Sweep(createBase(), {}).at(1), std::out_of_range);
+}
+
+TEST(MemSpecSweep, LatinHypercube)
+{
+    const MemSpec::MemSpecSweep sweep(createBase(), {
+        MemSpec::MemSpecSweep::Range::linear("memtimingspec.RCD", 0, 99, 1),
+        MemSpec::MemSpecSweep::Range::linear("memtimingspec.RP", 0, 9, 1),
+    });
+    const auto points = sweep.latinHypercube(10, 42);
+    ASSERT_EQ(points.size(), 10u);
+
+    // Every stratum of every range is hit exactly once
+    std::set<std::size_t> rcd;
+    std::set<std::size_t> rp;
+    for (const auto& point : points)
+    {
+        ASSERT_EQ(point.size(), 2u);
+        rcd.insert(point[0] / 10);
+        rp.insert(point[1]);
+        const auto memspec = sweep.make(point);
+        EXPECT_EQ(ddr5(memspec).memtimingspec.RCD, point[0]);
+        EXPECT_EQ(ddr5(memspec).memtimingspec.RP, point[1]);
+    }
+    EXPECT_EQ(rcd.size(), 10u);
+    EXPECT_EQ(rp.size(), 10u);
+
+    EXPECT_EQ(sweep.latinHypercube(10, 42), points);
+    EXPECT_NE(sweep.latinHypercube(10, 43), points);
+}
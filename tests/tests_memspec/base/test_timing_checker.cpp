@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+using MemSpec::TimingCommand;
+using MemSpec::TimingScope;
+
+class Memspec_TimingChecker_Test : public ::testing::Test
+{
+protected:
+    MemSpec::MemSpecDDR4 memspec{};
+
+    void SetUp() override
+    {
+        auto& arch = memspec.memarchitecturespec;
+        arch.nbrOfRanks = 2;
+        arch.nbrOfBankGroups = 4;
+        arch.nbrOfBanks = 16;
+        arch.burstLength = 8;
+        arch.dataRate = 2;
+        arch.RefMode = 1;
+
+        auto& t = memspec.memtimingspec;
+        t.tCK = 833e-12;
+        t.RCD = 10;
+        t.RP = 10;
+        t.RAS = 28;
+        t.RC = 38;
+        t.RL = 11;
+        t.WL = 9;
+        t.RTP = 6;
+        t.WR = 12;
+        t.CCD_L = 6;
+        t.CCD_S = 4;
+        t.RRD_L = 6;
+        t.RRD_S = 4;
+        t.FAW = 20;
+        t.WTR_L = 8;
+        t.WTR_S = 3;
+        t.RTRS = 2;
+        t.RFC1 = 200;
+        t.RFC2 = 150;
+    }
+};
+
+TEST_F(Memspec_TimingChecker_Test, Matrix)
+{
+    const auto matrix = MemSpec::make_constraint_matrix(memspec);
+    EXPECT_EQ(matrix.distance(TimingCommand::ACT, TimingCommand::RD, TimingScope::SameBank), 10u);
+    EXPECT_EQ(matrix.distance(TimingCommand::ACT, TimingCommand::ACT, TimingScope::SameBank), 38u);
+    EXPECT_EQ(matrix.distance(TimingCommand::WRA, TimingCommand::ACT, TimingScope::SameBank), 9u + 4u + 12u + 10u);
+    EXPECT_EQ(matrix.distance(TimingCommand::RD, TimingCommand::RDA, TimingScope::SameBankGroup), 6u);
+    EXPECT_EQ(matrix.distance(TimingCommand::RD, TimingCommand::WR, TimingScope::SameRank), 11u + 4u + 2u - 9u);
+    EXPECT_EQ(matrix.distance(TimingCommand::WR, TimingCommand::RD, TimingScope::OtherRank), 9u + 4u + 2u - 11u);
+    EXPECT_EQ(matrix.distance(TimingCommand::ACT, TimingCommand::ACT, TimingScope::OtherRank), 0u);
+    EXPECT_EQ(matrix.faw(), 20u);
+
+    memspec.memarchitecturespec.RefMode = 2;
+    EXPECT_EQ(MemSpec::make_constraint_matrix(memspec).distance(TimingCommand::REFAB, TimingCommand::ACT, TimingScope::SameRank), 150u);
+}
+
+TEST_F(Memspec_TimingChecker_Test, Activate)
+{
+    auto checker = MemSpec::make_timing_checker(memspec);
+    const MemSpec::BankAddress bank{0, 0, 0};
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, bank), 0u);
+
+    checker.issue(TimingCommand::ACT, bank, 0);
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, bank), 10u);
+    EXPECT_EQ(checker.earliest(TimingCommand::PRE, bank), 28u);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, bank), 38u);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {0, 0, 1}), 6u);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {0, 1, 0}), 4u);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {1, 0, 0}), 0u);
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, {0, 0, 1}), 0u);
+
+    EXPECT_FALSE(checker.isLegal(TimingCommand::RD, bank, 9));
+    EXPECT_TRUE(checker.isLegal(TimingCommand::RD, bank, 10));
+}
+
+TEST_F(Memspec_TimingChecker_Test, FourActivateWindow)
+{
+    auto checker = MemSpec::make_timing_checker(memspec);
+    checker.issue(TimingCommand::ACT, {0, 0, 0}, 0);
+    checker.issue(TimingCommand::ACT, {0, 1, 0}, 4);
+    checker.issue(TimingCommand::ACT, {0, 2, 0}, 8);
+    checker.issue(TimingCommand::ACT, {0, 3, 0}, 12);
+
+    // tRRD_S would allow 16
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {0, 1, 1}), 20u);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {1, 0, 0}), 0u);
+
+    checker.issue(TimingCommand::ACT, {0, 1, 1}, 20);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {0, 2, 1}), 24u);
+}
+
+TEST_F(Memspec_TimingChecker_Test, DataBus)
+{
+    auto checker = MemSpec::make_timing_checker(memspec);
+    checker.issue(TimingCommand::RD, {0, 0, 0}, 20);
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, {0, 0, 1}), 26u);
+    EXPECT_EQ(checker.earliest(TimingCommand::RDA, {0, 1, 0}), 24u);
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, {1, 0, 0}), 26u);
+    EXPECT_EQ(checker.earliest(TimingCommand::WR, {0, 1, 0}), 28u);
+
+    checker.issue(TimingCommand::WR, {1, 0, 0}, 100);
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, {1, 0, 1}), 121u);
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, {1, 1, 0}), 116u);
+    // The previous read of rank 0 is older than the write
+    EXPECT_EQ(checker.earliest(TimingCommand::RD, {0, 0, 0}), 104u);
+
+    checker.issue(TimingCommand::WR, {1, 0, 0}, 110);
+    EXPECT_EQ(checker.earliest(TimingCommand::WR, {0, 0, 0}), 116u);
+}
+
+TEST_F(Memspec_TimingChecker_Test, Refresh)
+{
+    auto checker = MemSpec::make_timing_checker(memspec);
+    checker.issue(TimingCommand::PRE, {0, 2, 3}, 50);
+    EXPECT_EQ(checker.earliest(TimingCommand::REFAB, {0, 0, 0}), 60u);
+
+    checker.issue(TimingCommand::REFAB, {0, 0, 0}, 60);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {0, 3, 2}), 260u);
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {1, 3, 2}), 0u);
+
+    checker.reset();
+    EXPECT_EQ(checker.earliest(TimingCommand::ACT, {0, 3, 2}), 0u);
+}
+
+TEST_F(Memspec_TimingChecker_Test, Variant)
+{
+    MemSpec::MemSpecVariant variant;
+    variant.setVariant(memspec);
+    const auto checker = MemSpec::make_timing_checker(variant);
+    ASSERT_TRUE(checker);
+    EXPECT_EQ(checker->matrix().faw(), 20u);
+
+    variant.setVariant(MemSpec::MemSpecGDDR5{});
+    EXPECT_FALSE(MemSpec::make_timing_checker(variant));
+
+    memspec.memarchitecturespec.nbrOfRanks = 0;
+    EXPECT_THROW(MemSpec::make_timing_checker(memspec), std::invalid_argument);
+}
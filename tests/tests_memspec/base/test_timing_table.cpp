@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+static_assert(alignof(MemSpec::TimingTableDDR5) == 64);
+static_assert(MemSpec::TimingTableDDR5::size == 51);
+static_assert(MemSpec::TimingTableDDR3::size == 26);
+
+TEST(Memspec_TimingTable_Test, DDR5)
+{
+    MemSpec::MemTimingSpecTypeDDR5 spec{};
+    spec.tCK = 625e-12;
+    spec.RCD = 39;
+    spec.RP = 39;
+    spec.REFPDEN = 1;
+
+    const auto table = MemSpec::make_timing_table(spec);
+    using Constraint = MemSpec::TimingConstraintDDR5;
+
+    EXPECT_EQ(table.tCK(), 625e-12);
+    EXPECT_EQ(table.tCKps(), 625u);
+    EXPECT_EQ(table.cycles(Constraint::RCD), 39u);
+    EXPECT_EQ(table.ps(Constraint::RCD), 39u * 625u);
+    EXPECT_EQ(table.cycles(Constraint::RP), 39u);
+    EXPECT_EQ(table.cycles(Constraint::REFPDEN), 1u);
+    EXPECT_EQ(table.ps(Constraint::REFPDEN), 625u);
+    EXPECT_EQ(table.cycles(Constraint::RAS), 0u);
+}
+
+TEST(Memspec_TimingTable_Test, Scale)
+{
+    MemSpec::MemTimingSpecDDR3 spec{};
+    spec.tCK = 1.25;
+    spec.RCD = 11;
+
+    // tCK in ns
+    const auto table = MemSpec::make_timing_table(spec, 1000.0);
+    EXPECT_EQ(table.tCKps(), 1250u);
+    EXPECT_EQ(table.cycles(MemSpec::TimingConstraintDDR3::RCD), 11u);
+    EXPECT_EQ(table.ps(MemSpec::TimingConstraintDDR3::RCD), 13750u);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "DRAMUtils/config/toggling_rate_estimator.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+using namespace DRAMUtils;
+
+TEST(Toggling_Rate_Estimator_Test, Pattern)
+{
+    // x8 with burst length 8, one byte per beat
+    Config::ToggleRateEstimator estimator(8, 8);
+
+    // Every line toggles on every beat, half of the bits are ones
+    const std::vector<std::uint8_t> alternating{0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+                                                0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00};
+    estimator.addRead(alternating.data(), alternating.size());
+
+    // Constant data never toggles, the transition between the bursts is not counted
+    const std::vector<std::uint8_t> constant{0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+                                             0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    estimator.addWrite(constant.data(), constant.size());
+
+    EXPECT_EQ(estimator.readBursts(), 2u);
+    EXPECT_EQ(estimator.writeBursts(), 2u);
+
+    const auto definition = estimator.toggleRateDefinition(Config::TogglingRateIdlePattern::L, Config::TogglingRateIdlePattern::H);
+    EXPECT_DOUBLE_EQ(definition.togglingRateRead, 1.0);
+    EXPECT_DOUBLE_EQ(definition.dutyCycleRead, 0.5);
+    EXPECT_DOUBLE_EQ(definition.togglingRateWrite, 0.0);
+    EXPECT_DOUBLE_EQ(definition.dutyCycleWrite, 0.75);
+    EXPECT_EQ(definition.idlePatternWrite, Config::TogglingRateIdlePattern::H);
+
+    estimator.reset();
+    EXPECT_EQ(estimator.toggleRateDefinition().togglingRateRead, 0.0);
+}
+
+TEST(Toggling_Rate_Estimator_Test, Random)
+{
+    // x16 with burst length 16 from a memarchitecturespec
+    MemSpec::MemArchitectureSpecTypeLPDDR5 spec{};
+    spec.width = 16;
+    spec.burstLength = 16;
+    Config::ToggleRateEstimator estimator(spec);
+    ASSERT_EQ(estimator.burstBytes(), 32u);
+
+    std::mt19937 gen(42);
+    std::bernoulli_distribution bit(0.25);
+    const std::size_t bursts = 1000;
+    std::vector<std::uint8_t> data(bursts * estimator.burstBytes());
+    for (auto& byte : data)
+        for (int i = 0; i < 8; ++i)
+            byte |= static_cast<std::uint8_t>(bit(gen)) << i;
+
+    // Reference count beat by beat
+    std::uint64_t ones = 0;
+    std::uint64_t toggles = 0;
+    for (std::size_t burst = 0; burst < bursts; ++burst)
+    {
+        const std::uint8_t* b = data.data() + burst * 32;
+        for (std::size_t i = 0; i < 32; ++i)
+        {
+            ones += Config::detail::popcount64(b[i]);
+            if (i >= 2)
+                toggles += Config::detail::popcount64(b[i] ^ b[i - 2]);
+        }
+    }
+
+    estimator.addRead(data.data(), data.size());
+    const auto definition = estimator.toggleRateDefinition();
+    EXPECT_DOUBLE_EQ(definition.dutyCycleRead, static_cast<double>(ones) / (bursts * 256));
+    EXPECT_DOUBLE_EQ(definition.togglingRateRead, static_cast<double>(toggles) / (bursts * 15 * 16));
+    EXPECT_NEAR(definition.dutyCycleRead, 0.25, 0.01);
+    EXPECT_NEAR(definition.togglingRateRead, 2 * 0.25 * 0.75, 0.01);
+}
+
+TEST(Toggling_Rate_Estimator_Test, Kernels)
+{
+    std::mt19937 gen(1);
+    std::vector<std::uint8_t> a(1031), b(1031);
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = static_cast<std::uint8_t>(gen());
+        b[i] = static_cast<std::uint8_t>(gen());
+    }
+
+    for (std::size_t size : {0, 1, 31, 32, 63, 64, 100, 1031})
+    {
+        const auto expected = Config::detail::popcount_xor_scalar(a.data(), b.data(), size);
+        EXPECT_EQ(Config::detail::popcount_xor(a.data(), b.data(), size), expected);
+        EXPECT_EQ(Config::detail::popcount_xor(a.data(), nullptr, size),
+                  Config::detail::popcount_xor_scalar(a.data(), nullptr, size));
+#if DRAMUTILS_HAS_X86_SIMD
+        if (__builtin_cpu_supports("avx2"))
+        {
+            EXPECT_EQ(Config::detail::popcount_xor_avx2(a.data(), b.data(), size), expected);
+        }
+        if (__builtin_cpu_supports("avx512vpopcntdq") && __builtin_cpu_supports("avx512bw"))
+        {
+            EXPECT_EQ(Config::detail::popcount_xor_avx512(a.data(), b.data(), size), expected);
+        }
+#endif
+    }
+}
+
+TEST(Toggling_Rate_Estimator_Test, InvalidArguments)
+{
+    EXPECT_THROW(Config::ToggleRateEstimator(12, 8), std::invalid_argument);
+    EXPECT_THROW(Config::ToggleRateEstimator(8, 0), std::invalid_argument);
+
+    Config::ToggleRateEstimator estimator(8, 8);
+    const std::vector<std::uint8_t> partial(12);
+    EXPECT_THROW(estimator.addRead(partial.data(), partial.size()), std::invalid_argument);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/util/json_sax.h"
+#include "DRAMUtils/util/json_utils.h"
+#include "DRAMUtils/util/json_writer.h"
+
+using namespace DRAMUtils;
+
+namespace variant_match_test
+{
+
+struct Window
+{
+    uint64_t begin;
+    uint64_t end;
+};
+NLOHMANN_JSONIFY_ALL_THINGS(Window, begin, end)
+
+struct Scaled
+{
+    double factor;
+    std::optional<std::string> unit;
+};
+NLOHMANN_JSONIFY_ALL_THINGS(Scaled, factor, unit)
+
+using Value = std::variant<int64_t, double, std::string, Window, Scaled, std::vector<int>>;
+
+// std::variant fields are merged into the enclosing object, optional variants use their key
+struct Holder
+{
+    std::variant<Window, Scaled> range;
+    std::optional<Value> extra;
+    std::string name;
+};
+NLOHMANN_JSONIFY_ALL_THINGS(Holder, range, extra, name)
+
+} // namespace variant_match_test
+
+using namespace variant_match_test;
+
+TEST(Variant_Match_Test, Matches)
+{
+    ASSERT_TRUE(util::json_matches<uint64_t>(json_t(3)));
+    ASSERT_FALSE(util::json_matches<uint64_t>(json_t(-3)));
+    ASSERT_FALSE(util::json_matches<int>(json_t(1.5)));
+    ASSERT_TRUE(util::json_matches<double>(json_t(1)));
+    ASSERT_FALSE(util::json_matches<std::string>(json_t(1)));
+    ASSERT_TRUE(util::json_matches<std::optional<int>>(json_t(nullptr)));
+
+    ASSERT_TRUE(util::json_matches<Window>(json_t{{"begin", 1}, {"end", 2}}));
+    ASSERT_FALSE(util::json_matches<Window>(json_t{{"begin", 1}}));
+    ASSERT_FALSE(util::json_matches<Window>(json_t{{"begin", 1}, {"end", "2"}}));
+    ASSERT_TRUE(util::json_matches<Scaled>(json_t{{"factor", 1.5}}));
+    ASSERT_FALSE(util::json_matches<Scaled>(json_t{{"factor", 1.5}, {"unit", 1}}));
+}
+
+TEST(Variant_Match_Test, LastMatch)
+{
+    auto parse = [](const json_t& j) { return j.get<Value>(); };
+
+    // Integers match int64_t and double, the last matching alternative wins
+    ASSERT_EQ(parse(json_t(4)).index(), 1);
+    ASSERT_EQ(std::get<double>(parse(json_t(4))), 4.0);
+    ASSERT_EQ(std::get<double>(parse(json_t(4.5))), 4.5);
+    ASSERT_EQ(std::get<std::string>(parse(json_t("ns"))), "ns");
+
+    const auto window = std::get<Window>(parse(json_t{{"begin", 1}, {"end", 2}}));
+    ASSERT_EQ(window.begin, 1);
+    ASSERT_EQ(window.end, 2);
+
+    const auto scaled = std::get<Scaled>(parse(json_t{{"factor", 0.5}, {"unit", "ps"}}));
+    ASSERT_EQ(scaled.factor, 0.5);
+    ASSERT_EQ(scaled.unit, "ps");
+
+    ASSERT_EQ(std::get<std::vector<int>>(parse(json_t{1, 2, 3})).size(), 3);
+
+    // No matching alternative leaves the value unchanged
+    Value value = 1.5;
+    util::variant_from_json(json_t(true), value);
+    ASSERT_EQ(std::get<double>(value), 1.5);
+}
+
+TEST(Variant_Match_Test, Overlap)
+{
+    ASSERT_EQ((json_t(3).get<std::variant<double, uint64_t>>().index()), 1);
+    ASSERT_EQ((json_t(3).get<std::variant<uint64_t, double>>().index()), 1);
+    ASSERT_EQ((json_t(-3).get<std::variant<double, uint64_t>>().index()), 0);
+    ASSERT_EQ((json_t(0.5).get<std::variant<double, uint64_t>>().index()), 0);
+}
+
+TEST(Variant_Match_Test, Field)
+{
+    // The alternative of range is read from the enclosing object
+    const json_t j = {{"begin", 1}, {"end", 2}, {"extra", "ps"}, {"name", "holder"}};
+    ASSERT_TRUE(util::json_matches<Holder>(j));
+    ASSERT_FALSE(util::json_matches<Holder>(json_t{{"range", {{"begin", 1}, {"end", 2}}}, {"name", "holder"}}));
+
+    const auto holder = j.get<Holder>();
+    ASSERT_EQ(std::get<Window>(holder.range).end, 2);
+    ASSERT_EQ(std::get<std::string>(*holder.extra), "ps");
+    ASSERT_EQ(holder.name, "holder");
+
+    json_t out = holder;
+    ASSERT_EQ(out, j);
+
+    std::string text;
+    util::StringSink sink{text};
+    util::write_json(sink, holder);
+    ASSERT_EQ(json_t::parse(text), j);
+
+    Holder parsed;
+    const std::string input = j.dump();
+    ASSERT_EQ(util::sax::parse(input.begin(), input.end(), parsed), util::ParseStatus::Ok);
+    ASSERT_EQ(std::get<Window>(parsed.range).begin, 1);
+    ASSERT_EQ(parsed.name, "holder");
+}
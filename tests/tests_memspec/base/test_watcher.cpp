@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpecWatcher.h"
+
+#include "memspec_fixture.h"
+
+using namespace DRAMUtils;
+
+class Memspec_Watcher_Test : public ::testing::Test
+{
+protected:
+    std::filesystem::path directory;
+    std::filesystem::path path;
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "dramutils_test_watcher";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        path = directory / "memspec.json";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    static std::string memSpecBuffer(const std::string& id)
+    {
+        return test::memspecJson(test::createMemSpec<MemSpec::MemSpecDDR4>(id)).dump();
+    }
+
+    // Editors usually write a temporary file and rename it
+    void replace(const std::string& content)
+    {
+        const auto temporary = directory / "memspec.json.tmp";
+        std::ofstream(temporary) << content;
+        std::filesystem::rename(temporary, path);
+    }
+
+    static std::string memoryId(const MemSpec::MemSpecWatcher::Snapshot& snapshot)
+    {
+        return std::get<MemSpec::MemSpecDDR4>(snapshot->getVariant()).memoryId.str();
+    }
+
+    template <typename Predicate>
+    static bool waitFor(Predicate predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+};
+
+TEST_F(Memspec_Watcher_Test, InitialLoad)
+{
+    std::ofstream(path) << memSpecBuffer("Initial");
+    MemSpec::MemSpecWatcher watcher(path);
+    ASSERT_EQ(watcher.version(), 1u);
+    ASSERT_NE(watcher.current(), nullptr);
+    ASSERT_EQ(memoryId(watcher.current()), "Initial");
+}
+
+TEST_F(Memspec_Watcher_Test, InitialLoadFails)
+{
+    std::ofstream(path) << "{ invalid";
+    ASSERT_THROW(MemSpec::MemSpecWatcher watcher(path), std::runtime_error);
+    ASSERT_THROW(MemSpec::MemSpecWatcher watcher(directory / "missing.json"), std::runtime_error);
+}
+
+TEST_F(Memspec_Watcher_Test, Reload)
+{
+    std::ofstream(path) << memSpecBuffer("Initial");
+    MemSpec::MemSpecWatcher watcher(path);
+    const auto old = watcher.current();
+
+    replace(memSpecBuffer("Renamed"));
+    ASSERT_TRUE(waitFor([&] { return watcher.version() == 2; }));
+    ASSERT_EQ(memoryId(watcher.current()), "Renamed");
+    // Snapshots held by readers are not modified
+    ASSERT_EQ(memoryId(old), "Initial");
+
+    std::ofstream(path) << memSpecBuffer("Written");
+    ASSERT_TRUE(waitFor([&] { return memoryId(watcher.current()) == "Written"; }));
+}
+
+TEST_F(Memspec_Watcher_Test, RejectInvalid)
+{
+    std::ofstream(path) << memSpecBuffer("Initial");
+    std::atomic<int> errors{0};
+    std::atomic<util::ParseStatus> status{util::ParseStatus::Ok};
+    MemSpec::MemSpecWatcher watcher(path, DRAMUtils::detail::keys::memSpec,
+        [](const MemSpec::MemSpecVariant& memspec) {
+            return std::get<MemSpec::MemSpecDDR4>(memspec.getVariant()).memoryId != "Rejected";
+        },
+        [&](const util::ParseError& error) {
+            status = error.status;
+            ++errors;
+        });
+
+    replace("{ \"memspec\": { \"memoryType\": \"DDR4\" } }");
+    ASSERT_TRUE(waitFor([&] { return errors == 1; }));
+    ASSERT_EQ(status, util::ParseStatus::InvalidValue);
+
+    replace(memSpecBuffer("Rejected"));
+    ASSERT_TRUE(waitFor([&] { return errors == 2; }));
+
+    ASSERT_EQ(watcher.version(), 1u);
+    ASSERT_EQ(memoryId(watcher.current()), "Initial");
+
+    replace(memSpecBuffer("Accepted"));
+    ASSERT_TRUE(waitFor([&] { return watcher.version() == 2; }));
+    ASSERT_EQ(memoryId(watcher.current()), "Accepted");
+}
+
+TEST_F(Memspec_Watcher_Test, ConcurrentReaders)
+{
+    std::ofstream(path) << memSpecBuffer("Version0");
+    MemSpec::MemSpecWatcher watcher(path);
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::thread reader([&] {
+        while (!done)
+        {
+            const auto snapshot = watcher.current();
+            consistent = consistent && memoryId(snapshot).rfind("Version", 0) == 0;
+        }
+    });
+
+    for (int i = 1; i <= 5; ++i)
+    {
+        replace(memSpecBuffer("Version" + std::to_string(i)));
+        ASSERT_TRUE(waitFor([&] { return watcher.version() == static_cast<std::uint64_t>(i) + 1; }));
+    }
+    done = true;
+    reader.join();
+    ASSERT_TRUE(consistent);
+    ASSERT_EQ(memoryId(watcher.current()), "Version5");
+}
@@ -0,0 +1,201 @@
+#ifndef TOOLS_MEMSPEC_CODEGEN_CODEGEN_H
+#define TOOLS_MEMSPEC_CODEGEN_CODEGEN_H
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "DRAMUtils/memspec/MemSpec.h"
+
+namespace codegen
+{
+
+using namespace DRAMUtils;
+
+inline std::string quote(std::string_view str)
+{
+    std::string result = "\"";
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+    }
+    return result + '"';
+}
+
+// C++ literal of an arithmetic value or a string
+template <typename T>
+std::string literal(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return value ? "true" : "false";
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        if (!std::isfinite(value))
+            throw std::invalid_argument("MemSpec holds a non finite value");
+
+        std::ostringstream stream;
+        stream << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+        std::string result = stream.str();
+        if (result.find_first_of(".e") == std::string::npos)
+            result += ".0";
+        return result;
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return literal(static_cast<std::underlying_type_t<T>>(value));
+    }
+    else if constexpr (std::is_unsigned_v<T>)
+    {
+        return std::to_string(value) + "ull";
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        return std::to_string(value) + "ll";
+    }
+    else
+    {
+        return quote(std::string_view(value));
+    }
+}
+
+/**
+ * @brief Writes one assignment per field of value, so that the assignments can be placed in a
+ *        constexpr function. Empty optionals are skipped.
+ * 
+ * @param path The expression referring to value, e.g. "m.memtimingspec"
+ */
+template <typename T>
+void write_assignments(std::ostream& os, const std::string& path, const T& value)
+{
+    if constexpr (util::is_optional<T>)
+    {
+        if (!value)
+            return;
+
+        if constexpr (util::has_json_fields<typename T::value_type>::value)
+        {
+            os << "    " << path << " = decltype(" << path << ")(std::in_place);\n";
+            write_assignments(os, "(*" + path + ")", *value);
+        }
+        else
+        {
+            os << "    " << path << " = decltype(" << path << ")(" << literal(*value) << ");\n";
+        }
+    }
+    else if constexpr (util::has_json_fields<T>::value)
+    {
+        util::for_each_field(value, [&os, &path](auto name, const auto& field) {
+            write_assignments(os, path + "." + std::string(name), field);
+        });
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        os << "    " << path << " = decltype(" << path << ")(" << literal(value) << ");\n";
+    }
+    else if constexpr (std::is_arithmetic_v<T> || util::is_fixed_string<T>)
+    {
+        os << "    " << path << " = " << literal(value) << ";\n";
+    }
+    else
+    {
+        static_assert(util::always_false<T>::value, "Field type not supported by the code generator");
+    }
+}
+
+// Writes the timing fields as static constexpr members
+template <typename Timing>
+void write_timing_constants(std::ostream& os, const Timing& timing)
+{
+    util::for_each_field(timing, [&os](auto name, const auto& field) {
+        using Field = std::decay_t<decltype(field)>;
+        if constexpr (std::is_arithmetic_v<Field>)
+        {
+            const char* type = std::is_floating_point_v<Field> ? "double" : "std::uint64_t";
+            os << "    static constexpr " << type << " " << name.value << " = " << literal(field) << ";\n";
+        }
+    });
+}
+
+struct Options
+{
+    std::string name;
+    std::string ns;
+    std::string source;
+};
+
+// Type names of the entries of MemSpec::VariantTypes
+constexpr std::array<std::string_view, 13> type_names = {
+    "MemSpecDDR3",
+    "MemSpecDDR4",
+    "MemSpecDDR5",
+    "MemSpecLPDDR4",
+    "MemSpecLPDDR5",
+    "MemSpecWideIO",
+    "MemSpecWideIO2",
+    "MemSpecGDDR5",
+    "MemSpecGDDR5X",
+    "MemSpecGDDR6",
+    "MemSpecHBM2",
+    "MemSpecHBM3",
+    "MemSpecSTTMRAM",
+};
+static_assert(type_names.size() == MemSpec::MemSpecVariant::size, "Type name missing for a standard");
+
+/**
+ * @brief Writes a header with the struct options.name, which holds the MemSpec as
+ *        static constexpr member memspec and the timings as static constexpr members.
+ */
+template <typename Standard>
+void write_header(std::ostream& os, const Standard& memspec, std::string_view type, const Options& options)
+{
+    os << "// Generated by dramutils_memspec_codegen from " << options.source << ". Do not edit.\n\n";
+    os << "#pragma once\n\n";
+    os << "#include <cstdint>\n";
+    os << "#include <optional>\n";
+    os << "#include <utility>\n\n";
+    os << "#include \"DRAMUtils/memspec/MemSpec.h\"\n\n";
+
+    if (!options.ns.empty())
+        os << "namespace " << options.ns << "\n{\n\n";
+
+    os << "namespace detail\n{\n\n";
+    os << "constexpr DRAMUtils::MemSpec::" << type << " make_" << options.name << "()\n{\n";
+    os << "    DRAMUtils::MemSpec::" << type << " m{};\n";
+    write_assignments(os, "m", memspec);
+    os << "    return m;\n}\n\n";
+    os << "} // namespace detail\n\n";
+
+    os << "struct " << options.name << "\n{\n";
+    os << "    using type = DRAMUtils::MemSpec::" << type << ";\n\n";
+    os << "    static constexpr type memspec = detail::make_" << options.name << "();\n\n";
+    os << "    // Timings of memtimingspec, tCK in seconds and all other timings in clock cycles\n";
+    write_timing_constants(os, memspec.memtimingspec);
+    os << "};\n";
+
+    if (!options.ns.empty())
+        os << "\n} // namespace " << options.ns << "\n";
+}
+
+inline void write_header(std::ostream& os, const MemSpec::MemSpecVariant& memspec, const Options& options)
+{
+    const std::string_view type = type_names[memspec.getVariant().index()];
+    std::visit([&os, type, &options](const auto& standard) { write_header(os, standard, type, options); },
+               memspec.getVariant());
+}
+
+} // namespace codegen
+
+#endif /* TOOLS_MEMSPEC_CODEGEN_CODEGEN_H */
@@ -0,0 +1,98 @@
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "DRAMUtils/util/json.h"
+#include "DRAMUtils/memspec/MemSpec.h"
+
+#include "codegen.h"
+
+using namespace DRAMUtils;
+
+namespace
+{
+
+void usage()
+{
+    std::cerr << "Usage: dramutils_memspec_codegen <memspec.json> <header.h> --name <name> "
+                 "[--namespace <namespace>] [--key <key>]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        usage();
+        return 1;
+    }
+
+    const std::string input = argv[1];
+    const std::string output = argv[2];
+    std::string key = "memspec";
+    codegen::Options options;
+    options.source = std::filesystem::path(input).filename().string();
+
+    for (int i = 3; i + 1 < argc; i += 2)
+    {
+        const std::string_view option = argv[i];
+        if (option == "--name")
+            options.name = argv[i + 1];
+        else if (option == "--namespace")
+            options.ns = argv[i + 1];
+        else if (option == "--key")
+            key = argv[i + 1];
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+    if (options.name.empty() || (argc - 3) % 2 != 0)
+    {
+        usage();
+        return 1;
+    }
+
+    try
+    {
+        std::ifstream file(input);
+        if (!file.is_open())
+        {
+            std::cerr << "Cannot open " << input << "\n";
+            return 1;
+        }
+        const json_t json = json_t::parse(file);
+
+        // Validate with the from_json of the standards, which reports the offending field
+        MemSpec::MemSpecVariant memspec;
+        const auto it = json.find(key);
+        if (!memspec.from_json(it != json.end() ? *it : json))
+        {
+            std::cerr << input << ": missing or unknown memoryType\n";
+            return 1;
+        }
+
+        if (const auto directory = std::filesystem::path(output).parent_path(); !directory.empty())
+            std::filesystem::create_directories(directory);
+
+        std::ofstream header(output);
+        codegen::write_header(header, memspec, options);
+        if (!header)
+        {
+            std::cerr << "Cannot write " << output << "\n";
+            return 1;
+        }
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << input << ": " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}